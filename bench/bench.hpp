@@ -0,0 +1,95 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace emb {
+namespace bench {
+
+// Keeps the compiler from eliding a computed value.
+template<typename T>
+inline void do_not_optimize(T const& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Best-of-`repeats` time per call of `op`, in nanoseconds. `op` is invoked
+// `iterations` times per repeat after one untimed warm-up repeat.
+template<typename F>
+double ns_per_op(std::size_t iterations, F&& op, std::size_t repeats = 5) {
+  using clock = std::chrono::steady_clock;
+  double best = 0.0;
+  for (std::size_t r = 0; r <= repeats; ++r) {
+    auto const start = clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+      op(i);
+    }
+    auto const stop = clock::now();
+    double const ns =
+        std::chrono::duration<double, std::nano>(stop - start).count()
+        / static_cast<double>(iterations);
+    if (r == 1 || (r > 1 && ns < best)) {
+      best = ns;
+    }
+  }
+  return best;
+}
+
+// Deterministic ADC-like test signal: 12-bit sawtooth ramp plus noise.
+inline std::vector<float> adc_signal(std::size_t count) {
+  std::vector<float> out(count);
+  std::uint32_t seed = 0x12345678u;
+  for (std::size_t i = 0; i < count; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    float const noise = static_cast<float>((seed >> 20) & 0xff) - 128.0f;
+    float const ramp = static_cast<float>(i % 4096);
+    out[i] = ramp + noise;
+  }
+  return out;
+}
+
+// Spin-then-yield wait for polling loops: cheap while the other thread is
+// running on its own core, and still makes progress when the threads share
+// one.
+class backoff {
+  unsigned spins_ = 0;
+public:
+  void pause() {
+    if (++spins_ >= 64) {
+      spins_ = 0;
+      std::this_thread::yield();
+    }
+  }
+};
+
+// Pins the calling thread to a core, taken modulo the number of hardware
+// threads. A no-op where thread affinity is not available.
+inline void pin_to_core(unsigned core) {
+#if defined(__linux__)
+  unsigned const cores = std::max(1u, std::thread::hardware_concurrency());
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(core % cores, &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void)core;
+#endif
+}
+
+// Nearest-rank percentile, q in [0, 1], of an ascending non-empty sample.
+inline double percentile(std::vector<double> const& sorted, double q) {
+  auto const rank = static_cast<std::size_t>(q * double(sorted.size() - 1));
+  return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+} // namespace bench
+} // namespace emb
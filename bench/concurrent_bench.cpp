@@ -0,0 +1,642 @@
+// Stress and latency suite for emb/concurrent under real std::thread
+// contention, every thread pinned to a core. Build it with
+// -DEMB_BENCH_SANITIZE_THREAD=ON to run it under ThreadSanitizer.
+//
+//   snapshot cells (one writer, several readers)
+//     stress:  the writer publishes self-consistent frames unthrottled while
+//              the readers poll; writes/s and reads/s, reader retries
+//              (attempts that overlapped a write), torn and backwards
+//              snapshots, writer stalls (rcu_cell: no free slot).
+//     latency: the writer publishes a timestamped frame at the loop rate and
+//              one reader polls; publish-to-visible p50/p99/p99.9/max.
+//   queues (one or two producers, one consumer)
+//     stream:  items/s, unthrottled, checking per-producer order.
+//     latency: push-to-pop at the loop rate.
+//
+// The loop rate defaults to 20 kHz; pass another in Hz as the only argument,
+// e.g. 1000. double_buffer and triple_buffer synchronize with signal fences,
+// so they run with all their threads on one core -- threads preempting each
+// other the way interrupt levels do -- and are skipped under TSan. The
+// double buffers may tear when the unthrottled writer outruns a reader,
+// which is their documented invariant; any other inconsistency makes the
+// program exit non-zero.
+
+#include "bench.hpp"
+
+#include <emb/concurrent/broadcast_ring.hpp>
+#include <emb/concurrent/double_buffer.hpp>
+#include <emb/concurrent/isr_mpsc_inplace_queue.hpp>
+#include <emb/concurrent/isr_spsc_inplace_queue.hpp>
+#include <emb/concurrent/rcu_cell.hpp>
+#include <emb/concurrent/seqlock.hpp>
+#include <emb/concurrent/seqlock_ring.hpp>
+#include <emb/concurrent/smp_double_buffer.hpp>
+#include <emb/concurrent/smp_spsc_inplace_queue.hpp>
+#include <emb/concurrent/triple_buffer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+using namespace std::chrono_literals;
+
+#if defined(__SANITIZE_THREAD__)
+constexpr bool under_tsan = true;
+#elif defined(__has_feature)
+#if __has_feature(thread_sanitizer)
+constexpr bool under_tsan = true;
+#else
+constexpr bool under_tsan = false;
+#endif
+#else
+constexpr bool under_tsan = false;
+#endif
+
+constexpr unsigned reader_count = 3;
+constexpr auto stress_time = 200ms;
+constexpr std::size_t queue_capacity = 1024;
+constexpr std::uint32_t stream_count = 1u << 20;
+
+std::int64_t now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             clock_type::now().time_since_epoch()
+  )
+      .count();
+}
+
+// 64-byte frame whose words all derive from seq, so a torn copy is
+// detectable; stamp_ns carries the publish time for latency runs.
+struct frame {
+  std::uint32_t seq;
+  std::uint32_t words[13];
+  std::int64_t stamp_ns;
+
+  static frame make(std::uint32_t seq, std::int64_t stamp_ns = 0) {
+    frame f{.seq = seq, .words = {}, .stamp_ns = stamp_ns};
+    for (std::uint32_t i = 0; i < 13; ++i) {
+      f.words[i] = seq * (i + 3) ^ 0x5a5a5a5au;
+    }
+    return f;
+  }
+
+  // The all-zero frame is what a cell holds before the first publish.
+  bool consistent() const {
+    if (seq == 0) {
+      return std::ranges::all_of(words, [](auto w) { return w == 0; });
+    }
+    for (std::uint32_t i = 0; i < 13; ++i) {
+      if (words[i] != (seq * (i + 3) ^ 0x5a5a5a5au)) return false;
+    }
+    return true;
+  }
+};
+
+// Uniform surface over the snapshot primitives:
+//   publish(f)                writer-side
+//   read(inspect, retries)    reader-side; hands inspect the reader's view
+//                             (a copy or an in-place reference, whatever
+//                             the primitive offers) and returns false when
+//                             there was nothing to read
+// Failed read attempts are added to retries, writer stalls to stalls.
+
+template<template<typename> class Cell>
+struct copying_cell {
+  Cell<frame> cell;
+  std::uint64_t stalls = 0;
+
+  void publish(frame const& f) {
+    cell.store(f);
+  }
+
+  template<typename F>
+  bool read(F&& inspect, std::uint64_t&) {
+    inspect(cell.load());
+    return true;
+  }
+};
+
+struct seqlock_cell {
+  emb::seqlock<frame> cell;
+  std::uint64_t stalls = 0;
+
+  void publish(frame const& f) {
+    cell.store(f);
+  }
+
+  template<typename F>
+  bool read(F&& inspect, std::uint64_t& retries) {
+    emb::bench::backoff wait;
+    for (;;) {
+      if (auto const snapshot = cell.try_load()) {
+        inspect(*snapshot);
+        return true;
+      }
+      ++retries;
+      wait.pause();
+    }
+  }
+};
+
+struct triple_buffer_cell {
+  emb::triple_buffer<frame> cell;
+  std::uint64_t stalls = 0;
+
+  void publish(frame const& f) {
+    cell.acquire_write() = f;
+    cell.publish();
+  }
+
+  template<typename F>
+  bool read(F&& inspect, std::uint64_t&) {
+    if (!cell.updated()) return false;
+    inspect(cell.acquire_read());
+    return true;
+  }
+};
+
+struct rcu_cell_cell {
+  emb::rcu_cell<frame, 4> cell{frame{}};
+  std::uint64_t stalls = 0;
+
+  void publish(frame const& f) {
+    while (!cell.try_publish(f)) {
+      ++stalls;
+      std::this_thread::yield();
+    }
+  }
+
+  template<typename F>
+  bool read(F&& inspect, std::uint64_t&) {
+    auto const guard = cell.read();
+    inspect(*guard);
+    return true;
+  }
+};
+
+struct seqlock_ring_cell {
+  emb::seqlock_ring<frame, 16> cell;
+  std::uint64_t stalls = 0;
+
+  void publish(frame const& f) {
+    cell.push(f);
+  }
+
+  template<typename F>
+  bool read(F&& inspect, std::uint64_t& retries) {
+    for (;;) {
+      auto const head = cell.head();
+      if (head == 0) return false;
+      if (auto const latest = cell.read(head - 1)) {
+        inspect(*latest);
+        return true;
+      }
+      ++retries;
+    }
+  }
+};
+
+// Every reader thread follows the ring through its own cursor; the copying
+// read hands back only samples that release() accepted, so the newest of
+// them is what the thread sees.
+struct broadcast_ring_cell {
+  using ring_type = emb::broadcast_ring<frame, 16>;
+
+  ring_type ring;
+  std::uint64_t stalls = 0;
+
+  void publish(frame const& f) {
+    ring.push(f);
+  }
+
+  template<typename F>
+  bool read(F&& inspect, std::uint64_t& retries) {
+    thread_local ring_type const* subscribed = nullptr;
+    thread_local std::optional<ring_type::reader> reader;
+    if (subscribed != &ring) {
+      reader.emplace(ring.subscribe());
+      subscribed = &ring;
+    }
+
+    std::array<frame, 16> out;
+    for (;;) {
+      if (reader->available() == 0) return false;
+      auto const count = reader->read(out);
+      if (count != 0) {
+        inspect(out[count - 1]);
+        return true;
+      }
+      ++retries;
+    }
+  }
+};
+
+struct cell_case {
+  char const* name;
+  unsigned readers;
+  bool single_core;
+  bool may_tear;
+};
+
+struct stress_result {
+  double writes_per_s = 0;
+  double reads_per_s = 0;
+  std::uint64_t retries = 0;
+  std::uint64_t torn = 0;
+  std::uint64_t backwards = 0;
+  std::uint64_t stalls = 0;
+};
+
+unsigned core_of(cell_case const& c, unsigned thread) {
+  return c.single_core ? 0 : thread;
+}
+
+template<typename Adapter>
+stress_result stress(cell_case const& c) {
+  auto adapter = std::make_unique<Adapter>();
+  std::atomic<bool> done = false;
+  std::vector<stress_result> results(c.readers);
+  std::vector<std::uint64_t> reads(c.readers);
+  std::vector<std::thread> readers;
+
+  for (unsigned r = 0; r < c.readers; ++r) {
+    readers.emplace_back([&, r] {
+      emb::bench::pin_to_core(core_of(c, r + 1));
+      auto& res = results[r];
+      std::uint32_t last = 0;
+      emb::bench::backoff wait;
+      while (!done.load(std::memory_order::relaxed)) {
+        bool const fresh = adapter->read(
+            [&](frame const& f) {
+              ++reads[r];
+              if (!f.consistent()) {
+                ++res.torn;
+              } else if (f.seq < last) {
+                ++res.backwards;
+              } else {
+                last = f.seq;
+              }
+            },
+            res.retries
+        );
+        if (!fresh) wait.pause();
+      }
+    });
+  }
+
+  std::uint32_t writes = 0;
+  auto const start = clock_type::now();
+  std::thread writer([&] {
+    emb::bench::pin_to_core(core_of(c, 0));
+    auto const stop = start + stress_time;
+    while (clock_type::now() < stop) {
+      for (int i = 0; i < 64; ++i) {
+        adapter->publish(frame::make(++writes));
+      }
+      std::this_thread::yield();
+    }
+  });
+  writer.join();
+  done = true;
+  for (auto& t : readers) {
+    t.join();
+  }
+  double const s =
+      std::chrono::duration<double>(clock_type::now() - start).count();
+
+  stress_result total;
+  total.writes_per_s = writes / s;
+  total.stalls = adapter->stalls;
+  for (unsigned r = 0; r < c.readers; ++r) {
+    total.reads_per_s += reads[r] / s;
+    total.retries += results[r].retries;
+    total.torn += results[r].torn;
+    total.backwards += results[r].backwards;
+  }
+  return total;
+}
+
+struct latency_result {
+  std::size_t seen = 0;
+  double p50 = 0;
+  double p99 = 0;
+  double p999 = 0;
+  double max = 0;
+};
+
+latency_result summarize(std::vector<double>& samples) {
+  latency_result res;
+  res.seen = samples.size();
+  if (samples.empty()) return res;
+  std::sort(samples.begin(), samples.end());
+  res.p50 = emb::bench::percentile(samples, 0.5);
+  res.p99 = emb::bench::percentile(samples, 0.99);
+  res.p999 = emb::bench::percentile(samples, 0.999);
+  res.max = samples.back();
+  return res;
+}
+
+// Publishes count frames at one per period; waits by yielding so that a
+// reader sharing the core gets to run.
+template<typename Publish>
+void paced(
+    std::chrono::nanoseconds period,
+    std::uint32_t count,
+    Publish&& publish
+) {
+  auto next = clock_type::now();
+  for (std::uint32_t i = 1; i <= count; ++i) {
+    next += period;
+    while (clock_type::now() < next) {
+      std::this_thread::yield();
+    }
+    publish(i);
+  }
+}
+
+template<typename Adapter>
+latency_result latency(
+    cell_case const& c,
+    std::chrono::nanoseconds period,
+    std::uint32_t count
+) {
+  auto adapter = std::make_unique<Adapter>();
+  std::atomic<bool> done = false;
+  std::vector<double> samples;
+  samples.reserve(count);
+
+  std::thread reader([&] {
+    emb::bench::pin_to_core(core_of(c, 1));
+    std::uint64_t retries = 0;
+    std::uint32_t last = 0;
+    emb::bench::backoff wait;
+    while (!done.load(std::memory_order::acquire)) {
+      bool fresh = false;
+      adapter->read(
+          [&](frame const& f) {
+            if (f.seq != last) {
+              samples.push_back(double(now_ns() - f.stamp_ns));
+              last = f.seq;
+              fresh = true;
+            }
+          },
+          retries
+      );
+      if (!fresh) wait.pause();
+    }
+  });
+
+  std::thread writer([&] {
+    emb::bench::pin_to_core(core_of(c, 0));
+    paced(period, count, [&](std::uint32_t i) {
+      adapter->publish(frame::make(i, now_ns()));
+    });
+  });
+  writer.join();
+  std::this_thread::sleep_for(1ms);
+  done.store(true, std::memory_order::release);
+  reader.join();
+  return summarize(samples);
+}
+
+struct queue_item {
+  std::uint32_t seq; // producer index in the top bit
+  std::int64_t stamp_ns;
+};
+
+constexpr std::uint32_t producer_bit = 1u << 31;
+
+struct queue_result {
+  double items_per_s = 0;
+  std::uint64_t disorder = 0;
+  latency_result latency;
+};
+
+template<typename Queue>
+void push_blocking(Queue& queue, queue_item const& item) {
+  emb::bench::backoff wait;
+  while (!queue.try_push(item)) {
+    wait.pause();
+  }
+}
+
+// Runs producer_count producers against one consumer. Each producer pushes
+// count items through push(p, i); the consumer hands every item to sink.
+template<typename Queue, typename Push, typename Sink>
+void run_queue(
+    Queue& queue,
+    unsigned producer_count,
+    std::uint32_t count,
+    Push&& push,
+    Sink&& sink
+) {
+  std::vector<std::thread> producers;
+  for (unsigned p = 0; p < producer_count; ++p) {
+    producers.emplace_back([&, p] {
+      emb::bench::pin_to_core(p + 1);
+      push(p, count);
+    });
+  }
+  emb::bench::pin_to_core(0);
+  emb::bench::backoff wait;
+  for (std::uint64_t n = 0; n < std::uint64_t(count) * producer_count;) {
+    if (auto const item = queue.try_pop()) {
+      sink(*item);
+      ++n;
+    } else {
+      wait.pause();
+    }
+  }
+  for (auto& t : producers) {
+    t.join();
+  }
+}
+
+template<typename Queue>
+queue_result queue_bench(
+    unsigned producer_count,
+    std::chrono::nanoseconds period,
+    std::uint32_t latency_count
+) {
+  queue_result res;
+  {
+    auto queue = std::make_unique<Queue>();
+    std::uint32_t last[2] = {0, 0};
+    auto const start = clock_type::now();
+    run_queue(
+        *queue,
+        producer_count,
+        stream_count / producer_count,
+        [&](unsigned p, std::uint32_t count) {
+          for (std::uint32_t i = 1; i <= count; ++i) {
+            push_blocking(*queue, {(p ? producer_bit : 0) | i, 0});
+          }
+        },
+        [&](queue_item const& item) {
+          auto& l = last[item.seq >> 31];
+          auto const seq = item.seq & ~producer_bit;
+          if (seq != l + 1) ++res.disorder;
+          l = seq;
+        }
+    );
+    double const s =
+        std::chrono::duration<double>(clock_type::now() - start).count();
+    res.items_per_s = stream_count / s;
+  }
+  {
+    auto queue = std::make_unique<Queue>();
+    std::vector<double> samples;
+    samples.reserve(std::size_t(latency_count) * producer_count);
+    run_queue(
+        *queue,
+        producer_count,
+        latency_count,
+        [&](unsigned p, std::uint32_t count) {
+          paced(period, count, [&](std::uint32_t i) {
+            push_blocking(*queue, {(p ? producer_bit : 0) | i, now_ns()});
+          });
+        },
+        [&](queue_item const& item) {
+          samples.push_back(double(now_ns() - item.stamp_ns));
+        }
+    );
+    res.latency = summarize(samples);
+  }
+  return res;
+}
+
+struct suite {
+  std::chrono::nanoseconds period;
+  std::uint32_t latency_count;
+  bool ok = true;
+
+  template<typename Adapter>
+  void cell(cell_case const& c) {
+    if (c.single_core && under_tsan) {
+      std::printf("%-18s skipped under TSan (signal fences only)\n", c.name);
+      return;
+    }
+    auto const s = stress<Adapter>(c);
+    auto const l = latency<Adapter>(c, period, latency_count);
+    std::printf(
+        "%-18s %2u%s %9.2f %9.2f %9llu %6llu %6llu %6llu"
+        " %9.0f %9.0f %9.0f %9.0f\n",
+        c.name,
+        c.readers,
+        c.single_core ? "*" : " ",
+        s.writes_per_s / 1e6,
+        s.reads_per_s / 1e6,
+        static_cast<unsigned long long>(s.retries),
+        static_cast<unsigned long long>(s.torn),
+        static_cast<unsigned long long>(s.backwards),
+        static_cast<unsigned long long>(s.stalls),
+        l.p50,
+        l.p99,
+        l.p999,
+        l.max
+    );
+    if (!c.may_tear && (s.torn != 0 || s.backwards != 0)) {
+      ok = false;
+    }
+  }
+
+  template<typename Queue>
+  void queue(char const* name, unsigned producer_count) {
+    auto const r = queue_bench<Queue>(producer_count, period, latency_count);
+    std::printf(
+        "%-24s %2u %9.2f %8llu %9.0f %9.0f %9.0f %9.0f\n",
+        name,
+        producer_count,
+        r.items_per_s / 1e6,
+        static_cast<unsigned long long>(r.disorder),
+        r.latency.p50,
+        r.latency.p99,
+        r.latency.p999,
+        r.latency.max
+    );
+    if (r.disorder != 0) {
+      ok = false;
+    }
+  }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+  double const rate_hz = argc > 1 ? std::atof(argv[1]) : 20000.0;
+  if (rate_hz <= 0) {
+    std::fprintf(stderr, "usage: %s [loop rate in Hz]\n", argv[0]);
+    return 2;
+  }
+  suite s{
+      .period = std::chrono::nanoseconds(std::int64_t(1e9 / rate_hz)),
+      .latency_count = std::max(2000u, unsigned(rate_hz / 2))
+  };
+
+  std::printf(
+      "hardware threads: %u, loop rate: %.0f Hz, latency samples: %u%s\n",
+      std::thread::hardware_concurrency(),
+      rate_hz,
+      s.latency_count,
+      under_tsan ? ", TSan" : ""
+  );
+  std::printf("* all threads on one core\n\n");
+
+  std::printf(
+      "%-18s %3s %9s %9s %9s %6s %6s %6s %9s %9s %9s %9s\n",
+      "cell",
+      "rd",
+      "Mwrite/s",
+      "Mread/s",
+      "retries",
+      "torn",
+      "back",
+      "stalls",
+      "p50 ns",
+      "p99 ns",
+      "p99.9 ns",
+      "max ns"
+  );
+  s.cell<seqlock_cell>({"seqlock", reader_count, false, false});
+  s.cell<copying_cell<emb::smp_double_buffer>>(
+      {"smp_double_buffer", reader_count, false, true}
+  );
+  s.cell<rcu_cell_cell>({"rcu_cell", reader_count, false, false});
+  s.cell<seqlock_ring_cell>({"seqlock_ring", reader_count, false, false});
+  s.cell<broadcast_ring_cell>({"broadcast_ring", reader_count, false, false});
+  s.cell<triple_buffer_cell>({"triple_buffer", 1, true, false});
+  s.cell<copying_cell<emb::double_buffer>>(
+      {"double_buffer", reader_count, true, true}
+  );
+
+  using isr_spsc = emb::isr_spsc_inplace_queue<queue_item, queue_capacity>;
+  using smp_spsc = emb::smp_spsc_inplace_queue<queue_item, queue_capacity>;
+  using isr_mpsc = emb::isr_mpsc_inplace_queue<queue_item, queue_capacity>;
+
+  std::printf(
+      "\n%-24s %2s %9s %8s %9s %9s %9s %9s\n",
+      "queue",
+      "pr",
+      "Mitem/s",
+      "disorder",
+      "p50 ns",
+      "p99 ns",
+      "p99.9 ns",
+      "max ns"
+  );
+  s.queue<isr_spsc>("isr_spsc_inplace_queue", 1);
+  s.queue<smp_spsc>("smp_spsc_inplace_queue", 1);
+  s.queue<isr_mpsc>("isr_mpsc_inplace_queue", 2);
+
+  return s.ok ? 0 : 1;
+}
@@ -0,0 +1,210 @@
+// Throughput of the batch math kernels against a loop over the scalar
+// functions they vectorize (sincos, fast_atan2, fast_sqrt), and their max
+// error against double precision std:: functions (relative for magnitude,
+// whose inputs span six decades). The lane width is fixed at compile time,
+// so the same source is built twice: math_batch_bench for the default target
+// and math_batch_bench_avx2 with -mavx2.
+
+#include "bench.hpp"
+
+#include <emb/math.hpp>
+#include <emb/math/batch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <numbers>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t block_size = 1024;
+constexpr std::size_t timing_blocks = 1u << 12;
+constexpr std::size_t sweep_count = 1u << 20;
+
+char const* lanes() {
+  using native = emb::detail::simd::native_ops;
+  switch (native::width) {
+  case 8:
+    return "avx2";
+  case 4:
+    return "sse2";
+  default:
+    return "scalar";
+  }
+}
+
+// ns per element of f(), which processes block_size elements per call.
+template<typename F>
+double ns_per_element(F f) {
+  return emb::bench::ns_per_op(timing_blocks, [&](std::size_t) { f(); })
+       / block_size;
+}
+
+struct data {
+  std::vector<float> a;
+  std::vector<float> b;
+  std::vector<float> out1;
+  std::vector<float> out2;
+
+  explicit data(std::size_t count)
+      : a(count), b(count), out1(count), out2(count) {}
+};
+
+data angles(std::size_t count) {
+  constexpr float range = 4 * std::numbers::pi_v<float>;
+  data d(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    d.a[i] = -range / 2 + range * float(i) / float(count);
+  }
+  return d;
+}
+
+// Points on circles of several radii, all angles.
+data vectors(std::size_t count) {
+  data d(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    double const angle = 2 * std::numbers::pi * double(i) / double(count);
+    double const radius = std::pow(10.0, double(i % 7) - 3.0);
+    d.a[i] = float(radius * std::cos(angle));
+    d.b[i] = float(radius * std::sin(angle));
+  }
+  return d;
+}
+
+template<typename Ref>
+double max_error(std::vector<float> const& got, Ref ref) {
+  double err = 0;
+  for (std::size_t i = 0; i < got.size(); ++i) {
+    err = std::max(err, std::fabs(double(got[i]) - ref(i)));
+  }
+  return err;
+}
+
+void report(char const* function, double err, double scalar, double batch) {
+  std::printf(
+      "%-10s %12.3g %12.3f %12.3f %8.2fx\n",
+      function,
+      err,
+      scalar,
+      batch,
+      scalar / batch
+  );
+}
+
+void report_sin() {
+  auto sweep = angles(sweep_count);
+  emb::sin_batch(sweep.a, sweep.out1);
+  double const err = max_error(sweep.out1, [&](std::size_t i) {
+    return std::sin(double(sweep.a[i]));
+  });
+
+  auto d = angles(block_size);
+  double const scalar = ns_per_element([&] {
+    for (std::size_t i = 0; i < block_size; ++i) {
+      d.out1[i] = emb::sincos(d.a[i]).sin;
+    }
+    emb::bench::do_not_optimize(d.out1.data());
+  });
+  double const batch = ns_per_element([&] {
+    emb::sin_batch(d.a, d.out1);
+    emb::bench::do_not_optimize(d.out1.data());
+  });
+  report("sin", err, scalar, batch);
+}
+
+void report_sincos() {
+  auto sweep = angles(sweep_count);
+  emb::sincos_batch(sweep.a, sweep.out1, sweep.out2);
+  double const err = std::max(
+      max_error(
+          sweep.out1,
+          [&](std::size_t i) { return std::sin(double(sweep.a[i])); }
+      ),
+      max_error(
+          sweep.out2,
+          [&](std::size_t i) { return std::cos(double(sweep.a[i])); }
+      )
+  );
+
+  auto d = angles(block_size);
+  double const scalar = ns_per_element([&] {
+    for (std::size_t i = 0; i < block_size; ++i) {
+      auto const [s, c] = emb::sincos(d.a[i]);
+      d.out1[i] = s;
+      d.out2[i] = c;
+    }
+    emb::bench::do_not_optimize(d.out1.data());
+    emb::bench::do_not_optimize(d.out2.data());
+  });
+  double const batch = ns_per_element([&] {
+    emb::sincos_batch(d.a, d.out1, d.out2);
+    emb::bench::do_not_optimize(d.out1.data());
+    emb::bench::do_not_optimize(d.out2.data());
+  });
+  report("sincos", err, scalar, batch);
+}
+
+void report_atan2() {
+  auto sweep = vectors(sweep_count);
+  emb::atan2_batch(sweep.b, sweep.a, sweep.out1);
+  double const err = max_error(sweep.out1, [&](std::size_t i) {
+    return std::atan2(double(sweep.b[i]), double(sweep.a[i]));
+  });
+
+  auto d = vectors(block_size);
+  double const scalar = ns_per_element([&] {
+    for (std::size_t i = 0; i < block_size; ++i) {
+      d.out1[i] = emb::fast_atan2(d.b[i], d.a[i]);
+    }
+    emb::bench::do_not_optimize(d.out1.data());
+  });
+  double const batch = ns_per_element([&] {
+    emb::atan2_batch(d.b, d.a, d.out1);
+    emb::bench::do_not_optimize(d.out1.data());
+  });
+  report("atan2", err, scalar, batch);
+}
+
+void report_magnitude() {
+  auto sweep = vectors(sweep_count);
+  emb::magnitude_batch(sweep.a, sweep.b, sweep.out1);
+  double err = 0;
+  for (std::size_t i = 0; i < sweep_count; ++i) {
+    double const ref = std::hypot(double(sweep.a[i]), double(sweep.b[i]));
+    err = std::max(err, std::fabs(double(sweep.out1[i]) - ref) / ref);
+  }
+
+  auto d = vectors(block_size);
+  double const scalar = ns_per_element([&] {
+    for (std::size_t i = 0; i < block_size; ++i) {
+      d.out1[i] = emb::fast_sqrt(d.a[i] * d.a[i] + d.b[i] * d.b[i]);
+    }
+    emb::bench::do_not_optimize(d.out1.data());
+  });
+  double const batch = ns_per_element([&] {
+    emb::magnitude_batch(d.a, d.b, d.out1);
+    emb::bench::do_not_optimize(d.out1.data());
+  });
+  report("magnitude", err, scalar, batch);
+}
+
+} // namespace
+
+int main() {
+  std::printf("lanes: %s, block of %zu\n", lanes(), block_size);
+  std::printf(
+      "%-10s %12s %12s %12s %9s\n",
+      "func",
+      "max err",
+      "scalar ns",
+      "batch ns",
+      "speedup"
+  );
+  report_sin();
+  report_sincos();
+  report_atan2();
+  report_magnitude();
+  return 0;
+}
@@ -0,0 +1,123 @@
+// Checks the batch math kernels against the scalar functions they vectorize.
+// The kernels use intrinsics, so unlike the static_assert tests under emb/
+// this has to run; ctest runs it for the default target and, built with
+// -mavx2, for the AVX2 lanes. 13 elements leave a tail past every lane width
+// (4 for SSE2, 8 for AVX2): the blocks take the vector path, the tail the
+// scalar one, and both must agree with the scalar functions to the last bits.
+
+#include <emb/foc/to_polar.hpp>
+#include <emb/math.hpp>
+#include <emb/math/batch.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+
+namespace {
+
+constexpr std::size_t count = 13;
+
+int failures = 0;
+
+void check(
+    char const* what,
+    std::size_t i,
+    float got,
+    float expected,
+    float tolerance
+) {
+  if (!(std::fabs(got - expected) <= tolerance)) {
+    std::printf(
+        "FAIL %s[%zu]: got %.9g, expected %.9g\n",
+        what,
+        i,
+        got,
+        expected
+    );
+    ++failures;
+  }
+}
+
+void test_sincos_batch() {
+  std::array<float, count> x;
+  for (std::size_t i = 0; i < count; ++i) {
+    x[i] = -10.0f + 1.618f * float(i);
+  }
+
+  std::array<float, count> s;
+  std::array<float, count> c;
+  emb::sincos_batch(x, s, c);
+  for (std::size_t i = 0; i < count; ++i) {
+    auto const ref = emb::sincos(x[i]);
+    check("sincos_batch sin", i, s[i], ref.sin, 1e-6f);
+    check("sincos_batch cos", i, c[i], ref.cos, 1e-6f);
+  }
+
+  // sin_batch, in place.
+  std::array<float, count> inout = x;
+  emb::sin_batch(inout, inout);
+  for (std::size_t i = 0; i < count; ++i) {
+    check("sin_batch", i, inout[i], emb::sincos(x[i]).sin, 1e-6f);
+  }
+}
+
+void test_atan2_batch() {
+  // All octants, the axes and the origin.
+  std::array<float, count> const y =
+      {0.0f, 0.0f, 1.0f, -1.0f, 0.5f, 3.0f, -2.0f, 1e-3f, -7.0f, 2.0f, 0.1f,
+       -0.4f, 9.0f};
+  std::array<float, count> const x =
+      {0.0f, -1.0f, 0.0f, 0.0f, 2.0f, -1.0f, -5.0f, 4.0f, 0.3f, 2.0f, -0.2f,
+       0.9f, -9.0f};
+
+  std::array<float, count> out;
+  emb::atan2_batch(y, x, out);
+  for (std::size_t i = 0; i < count; ++i) {
+    check("atan2_batch", i, out[i], emb::fast_atan2(y[i], x[i]), 1e-6f);
+  }
+}
+
+void test_magnitude_batch() {
+  std::array<float, count> a;
+  std::array<float, count> b;
+  for (std::size_t i = 0; i < count; ++i) {
+    float const scale = std::pow(10.0f, float(i % 7) - 3.0f);
+    a[i] = scale * (float(i) - 6.0f);
+    b[i] = scale * 0.75f * (float(i % 5) - 2.0f);
+  }
+  a[0] = 0.0f;
+  b[0] = 0.0f;
+
+  std::array<float, count> out;
+  emb::magnitude_batch(a, b, out);
+  check("magnitude_batch", 0, out[0], 0.0f, 0.0f);
+  for (std::size_t i = 1; i < count; ++i) {
+    float const ref = emb::fast_sqrt(a[i] * a[i] + b[i] * b[i]);
+    check("magnitude_batch", i, out[i], ref, 1e-6f * ref);
+  }
+
+  // foc::to_polar over arrays matches the single-vector overload.
+  std::array<float, count> mag;
+  std::array<float, count> theta;
+  emb::foc::to_polar(a, b, mag, theta);
+  for (std::size_t i = 1; i < count; ++i) {
+    auto const ref = emb::foc::to_polar({.alpha = a[i], .beta = b[i]});
+    check("to_polar mag", i, mag[i], ref.mag, 2e-5f * ref.mag);
+    check("to_polar theta", i, theta[i], ref.theta, 2e-5f);
+  }
+}
+
+} // namespace
+
+int main() {
+  test_sincos_batch();
+  test_atan2_batch();
+  test_magnitude_batch();
+  std::printf(
+      "lanes: %zu, %s\n",
+      emb::detail::simd::native_ops::width,
+      failures == 0 ? "ok" : "FAILED"
+  );
+  return failures == 0 ? 0 : 1;
+}
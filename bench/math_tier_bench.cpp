@@ -0,0 +1,187 @@
+// Accuracy and speed of the math accuracy tiers (lut_tier, poly_tier,
+// builtin_tier) for sin, cos, atan2 and sqrt. Errors are against double
+// precision std:: functions over a dense sweep of the input range; relative
+// error skips references below 1e-3 in magnitude, where it is meaningless
+// for the periodic functions. Throughput is measured over a precomputed
+// input array so that input generation stays out of the timing.
+
+#include "bench.hpp"
+
+#include <emb/math.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <numbers>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t sweep_count = 1u << 20;
+constexpr std::size_t timing_count = 4096;
+constexpr std::size_t timing_iterations = 1u << 20;
+
+struct error_result {
+  double max_abs = 0;
+  double max_rel = 0;
+};
+
+template<typename F, typename Ref>
+error_result measure_error(
+    std::vector<float> const& xs,
+    std::vector<float> const& ys,
+    F f,
+    Ref ref
+) {
+  error_result res;
+  for (std::size_t i = 0; i < xs.size(); ++i) {
+    double const expected = ref(double(xs[i]), double(ys[i]));
+    double const err = std::fabs(double(f(xs[i], ys[i])) - expected);
+    res.max_abs = std::max(res.max_abs, err);
+    if (std::fabs(expected) >= 1e-3) {
+      res.max_rel = std::max(res.max_rel, err / std::fabs(expected));
+    }
+  }
+  return res;
+}
+
+template<typename F>
+double
+measure_ns(std::vector<float> const& xs, std::vector<float> const& ys, F f) {
+  float acc = 0.0f;
+  double const ns =
+      emb::bench::ns_per_op(timing_iterations, [&](std::size_t i) {
+        std::size_t const k = i % timing_count;
+        acc += f(xs[k], ys[k]);
+      });
+  emb::bench::do_not_optimize(acc);
+  return ns;
+}
+
+struct inputs {
+  std::vector<float> xs;
+  std::vector<float> ys;
+
+  explicit inputs(std::size_t count) : xs(count), ys(count) {}
+};
+
+inputs periodic_inputs() {
+  constexpr float range = 4 * std::numbers::pi_v<float>;
+  inputs in(sweep_count);
+  for (std::size_t i = 0; i < sweep_count; ++i) {
+    in.xs[i] = -range / 2 + range * float(i) / float(sweep_count);
+  }
+  return in;
+}
+
+// Points on circles of several radii, all angles.
+inputs atan2_inputs() {
+  inputs in(sweep_count);
+  for (std::size_t i = 0; i < sweep_count; ++i) {
+    double const angle = 2 * std::numbers::pi * double(i) / sweep_count;
+    double const radius = std::pow(10.0, double(i % 7) - 3.0);
+    in.xs[i] = float(radius * std::sin(angle));
+    in.ys[i] = float(radius * std::cos(angle));
+  }
+  return in;
+}
+
+// Log-uniform over [1e-6, 1e6].
+inputs sqrt_inputs() {
+  inputs in(sweep_count);
+  for (std::size_t i = 0; i < sweep_count; ++i) {
+    in.xs[i] = float(std::pow(10.0, -6.0 + 12.0 * double(i) / sweep_count));
+  }
+  return in;
+}
+
+// Timing inputs: a stride through the sweep, so consecutive calls do not hit
+// neighbouring table entries.
+inputs timing_inputs(inputs const& sweep) {
+  inputs in(timing_count);
+  for (std::size_t i = 0; i < timing_count; ++i) {
+    std::size_t const k = (i * 7919) % sweep_count;
+    in.xs[i] = sweep.xs[k];
+    in.ys[i] = sweep.ys[k];
+  }
+  return in;
+}
+
+template<typename F, typename Ref>
+void report(
+    char const* function,
+    char const* tier,
+    inputs const& sweep,
+    F f,
+    Ref ref
+) {
+  auto const err = measure_error(sweep.xs, sweep.ys, f, ref);
+  auto const timing = timing_inputs(sweep);
+  std::printf(
+      "%-6s %-8s %12.3g %12.3g %10.2f\n",
+      function,
+      tier,
+      err.max_abs,
+      err.max_rel,
+      measure_ns(timing.xs, timing.ys, f)
+  );
+}
+
+template<emb::some_math_tier Tier>
+void report_tier(
+    char const* tier,
+    inputs const& periodic,
+    inputs const& angles,
+    inputs const& roots
+) {
+  report(
+      "sin",
+      tier,
+      periodic,
+      [](float x, float) { return emb::sin<Tier>(x); },
+      [](double x, double) { return std::sin(x); }
+  );
+  report(
+      "cos",
+      tier,
+      periodic,
+      [](float x, float) { return emb::cos<Tier>(x); },
+      [](double x, double) { return std::cos(x); }
+  );
+  report(
+      "atan2",
+      tier,
+      angles,
+      [](float y, float x) { return emb::atan2<Tier>(y, x); },
+      [](double y, double x) { return std::atan2(y, x); }
+  );
+  report(
+      "sqrt",
+      tier,
+      roots,
+      [](float x, float) { return emb::sqrt<Tier>(x); },
+      [](double x, double) { return std::sqrt(x); }
+  );
+}
+
+} // namespace
+
+int main() {
+  auto const periodic = periodic_inputs();
+  auto const angles = atan2_inputs();
+  auto const roots = sqrt_inputs();
+
+  std::printf(
+      "%-6s %-8s %12s %12s %10s\n",
+      "func",
+      "tier",
+      "max abs",
+      "max rel",
+      "ns/op"
+  );
+  report_tier<emb::lut_tier>("lut", periodic, angles, roots);
+  report_tier<emb::poly_tier>("poly", periodic, angles, roots);
+  report_tier<emb::builtin_tier>("builtin", periodic, angles, roots);
+  return 0;
+}
@@ -0,0 +1,82 @@
+// ns/push of emb::median_filter (sorting network up to 9 taps, incrementally
+// sorted window above) against the former copy-and-sort implementation, for
+// odd window sizes 3..63.
+
+#include "bench.hpp"
+
+#include <emb/container/circular_buffer.hpp>
+#include <emb/filter/median_filter.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <utility>
+
+namespace {
+
+// The pre-sorted-window median_filter::push, kept as the baseline.
+template<typename T, std::size_t WindowSize>
+class copy_sort_median_filter {
+  emb::circular_buffer<T, WindowSize> window_;
+  T output_{};
+public:
+  copy_sort_median_filter() {
+    window_.fill(T{});
+  }
+
+  void push(T const& input_v) {
+    window_.push_back(input_v);
+    std::array<T, WindowSize> window_sorted = {};
+    for (auto i = 0uz; i < window_.size(); ++i) {
+      window_sorted[i] = window_[i];
+    }
+    std::sort(window_sorted.begin(), window_sorted.end());
+    output_ = window_sorted[WindowSize / 2];
+  }
+
+  T const& output() const {
+    return output_;
+  }
+};
+
+constexpr std::size_t iterations = 1 << 18;
+
+template<std::size_t WindowSize>
+void run(std::vector<float> const& signal) {
+  copy_sort_median_filter<float, WindowSize> baseline;
+  emb::median_filter<float, WindowSize> filter;
+  auto const mask = signal.size() - 1;
+
+  double const ns_baseline = emb::bench::ns_per_op(iterations, [&](auto i) {
+    baseline.push(signal[i & mask]);
+    emb::bench::do_not_optimize(baseline.output());
+  });
+  double const ns_filter = emb::bench::ns_per_op(iterations, [&](auto i) {
+    filter.push(signal[i & mask]);
+    emb::bench::do_not_optimize(filter.output());
+  });
+
+  std::printf(
+      "%6zu %14.2f %14.2f %9.2fx\n",
+      WindowSize,
+      ns_baseline,
+      ns_filter,
+      ns_baseline / ns_filter
+  );
+}
+
+template<std::size_t... I>
+void run_all(std::vector<float> const& signal, std::index_sequence<I...>) {
+  (run<2 * I + 3>(signal), ...);
+}
+
+} // namespace
+
+int main() {
+  auto const signal = emb::bench::adc_signal(1 << 16);
+  std::printf(
+      "%6s %14s %14s %10s\n", "window", "copy+sort ns", "filter ns", "speedup"
+  );
+  run_all(signal, std::make_index_sequence<31>{});
+  return 0;
+}
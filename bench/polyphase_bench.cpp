@@ -0,0 +1,129 @@
+// ns/frame of the array-of-structures sensor::polyphase (N independent
+// singlephase pipelines) against the structure-of-arrays
+// sensor::soa_polyphase, for N = 3, 6 and 12 phases, with an exponential
+// and a 4th-order IIR filter stage.
+
+#include "bench.hpp"
+
+#include <emb/filter/exponential_filter.hpp>
+#include <emb/filter/iir_sos_filter.hpp>
+#include <emb/sensor.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+using code_type = std::uint16_t;
+using sec = emb::units::sec_f32;
+
+struct affine_converter {
+  float gain;
+  float offset;
+
+  float operator()(code_type code) const {
+    return gain * static_cast<float>(code) + offset;
+  }
+};
+
+constexpr std::size_t iterations = 1 << 18;
+constexpr sec ts{1.0f / 20000.0f};
+constexpr sec tau{1.0f / 500.0f};
+constexpr auto sos =
+    emb::butterworth_lowpass<2>(emb::units::hz_f32{1000.0f}, ts);
+
+template<std::size_t N>
+std::vector<std::array<code_type, N>> frames(std::size_t count) {
+  auto const signal = emb::bench::adc_signal(count * N);
+  std::vector<std::array<code_type, N>> out(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    for (std::size_t p = 0; p < N; ++p) {
+      out[i][p] = static_cast<code_type>(signal[i * N + p] + 256.0f);
+    }
+  }
+  return out;
+}
+
+template<typename Core>
+double measure(Core& core, auto const& input) {
+  auto const mask = input.size() - 1;
+  return emb::bench::ns_per_op(iterations, [&](auto i) {
+    core.submit(input[i & mask]);
+    emb::bench::do_not_optimize(core);
+  });
+}
+
+template<std::size_t N>
+void run() {
+  using emb::sensor::passthrough_prefilter;
+  auto const input = frames<N>(1 << 12);
+  affine_converter const conv{0.01f, -20.0f};
+
+  emb::sensor::polyphase<
+      passthrough_prefilter<code_type>,
+      affine_converter,
+      emb::exponential_filter<float, sec>,
+      N>
+      aos_ema({}, conv, emb::exponential_filter<float, sec>(ts, tau));
+  emb::sensor::soa_polyphase<
+      code_type,
+      emb::polyphase_exponential_filter<float, sec, N>,
+      N>
+      soa_ema(
+          conv.gain,
+          conv.offset,
+          emb::polyphase_exponential_filter<float, sec, N>(ts, tau)
+      );
+
+  emb::sensor::polyphase<
+      passthrough_prefilter<code_type>,
+      affine_converter,
+      emb::iir_sos_filter<float, 2>,
+      N>
+      aos_iir({}, conv, emb::iir_sos_filter<float, 2>(sos));
+  emb::sensor::soa_polyphase<
+      code_type,
+      emb::polyphase_iir_sos_filter<float, 2, N>,
+      N>
+      soa_iir(
+          conv.gain,
+          conv.offset,
+          emb::polyphase_iir_sos_filter<float, 2, N>(sos)
+      );
+
+  double const aos_ema_ns = measure(aos_ema, input);
+  double const soa_ema_ns = measure(soa_ema, input);
+  double const aos_iir_ns = measure(aos_iir, input);
+  double const soa_iir_ns = measure(soa_iir, input);
+
+  std::printf(
+      "%3zu %-8s %10.2f %10.2f %8.2fx\n",
+      N,
+      "ema",
+      aos_ema_ns,
+      soa_ema_ns,
+      aos_ema_ns / soa_ema_ns
+  );
+  std::printf(
+      "%3zu %-8s %10.2f %10.2f %8.2fx\n",
+      N,
+      "iir-4",
+      aos_iir_ns,
+      soa_iir_ns,
+      aos_iir_ns / soa_iir_ns
+  );
+}
+
+} // namespace
+
+int main() {
+  std::printf(
+      "%3s %-8s %10s %10s %9s\n", "N", "filter", "AoS ns", "SoA ns", "speedup"
+  );
+  run<3>();
+  run<6>();
+  run<12>();
+  return 0;
+}
@@ -0,0 +1,121 @@
+// Accuracy and speed of table_sincos over the sin_table sizes, element types
+// and interpolation modes: flash taken by the table, max abs error of sin and
+// cos against double precision std:: functions over a dense sweep of the
+// circle, and time per call over a precomputed array of angles.
+
+#include "bench.hpp"
+
+#include <emb/math.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <numbers>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t sweep_count = 1u << 22;
+constexpr std::size_t timing_count = 4096;
+constexpr std::size_t timing_iterations = 1u << 20;
+
+char const* interp_name(emb::table_interp interp) {
+  switch (interp) {
+  case emb::table_interp::nearest:
+    return "nearest";
+  case emb::table_interp::linear:
+    return "linear";
+  default:
+    return "angle_sum";
+  }
+}
+
+template<typename T>
+char const* type_name() {
+  if constexpr (std::same_as<T, float>) {
+    return "float";
+  } else if constexpr (std::same_as<T, std::int16_t>) {
+    return "q15";
+  } else {
+    return "q31";
+  }
+}
+
+template<typename T, std::size_t Steps, emb::table_interp Interp>
+void report(std::vector<emb::turns> const& timing) {
+  double err = 0;
+  for (std::size_t i = 0; i < sweep_count; ++i) {
+    // Spread over the full 32 bits so the step offset is exercised too.
+    emb::turns const angle(static_cast<std::uint32_t>(i * 1031u << 10 | i));
+    double const rad =
+        double(angle.raw()) * (2 * std::numbers::pi / 4294967296.0);
+    auto const [s, c] = emb::table_sincos<T, Steps, Interp>(angle);
+    err = std::max(err, std::fabs(double(s) - std::sin(rad)));
+    err = std::max(err, std::fabs(double(c) - std::cos(rad)));
+  }
+
+  float acc = 0.0f;
+  double const ns =
+      emb::bench::ns_per_op(timing_iterations, [&](std::size_t i) {
+        auto const [s, c] =
+            emb::table_sincos<T, Steps, Interp>(timing[i % timing_count]);
+        acc += s + c;
+      });
+  emb::bench::do_not_optimize(acc);
+
+  std::printf(
+      "%6zu %-6s %-10s %8zu %12.3g %8.2f\n",
+      Steps,
+      type_name<T>(),
+      interp_name(Interp),
+      sizeof(emb::sin_table<T, Steps>),
+      err,
+      ns
+  );
+}
+
+template<typename T, std::size_t Steps>
+void report_size(std::vector<emb::turns> const& timing) {
+  report<T, Steps, emb::table_interp::nearest>(timing);
+  report<T, Steps, emb::table_interp::linear>(timing);
+  report<T, Steps, emb::table_interp::angle_sum>(timing);
+}
+
+template<typename T>
+void report_type(std::vector<emb::turns> const& timing) {
+  report_size<T, 64>(timing);
+  report_size<T, 128>(timing);
+  report_size<T, 256>(timing);
+  report_size<T, 512>(timing);
+  report_size<T, 1024>(timing);
+  report_size<T, 2048>(timing);
+  report_size<T, 4096>(timing);
+}
+
+} // namespace
+
+int main() {
+  // A stride through the circle, so consecutive calls do not hit
+  // neighbouring table entries.
+  std::vector<emb::turns> timing(timing_count);
+  for (std::size_t i = 0; i < timing_count; ++i) {
+    timing[i] = emb::turns(static_cast<std::uint32_t>(i * 2654435761u));
+  }
+
+  std::printf(
+      "%6s %-6s %-10s %8s %12s %8s\n",
+      "steps",
+      "type",
+      "interp",
+      "bytes",
+      "max abs",
+      "ns/op"
+  );
+  report_type<float>(timing);
+  report_type<std::int16_t>(timing);
+  report_type<std::int32_t>(timing);
+  return 0;
+}
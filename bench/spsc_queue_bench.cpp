@@ -0,0 +1,123 @@
+// Two-thread SPSC queue benchmark: isr_spsc_inplace_queue (adjacent indices,
+// acquire reload per operation) against smp_spsc_inplace_queue (cache-line
+// separated, cached opposite index).
+//   throughput: one producer streams 32-bit words to one consumer
+//   latency:    ping-pong through a pair of queues; half the round trip
+// Both threads spin, yielding after a run of failed attempts so the benchmark
+// still completes when the two threads share one core. Run on a machine with
+// at least two cores for meaningful numbers.
+
+#include "bench.hpp"
+
+#include <emb/concurrent/isr_spsc_inplace_queue.hpp>
+#include <emb/concurrent/smp_spsc_inplace_queue.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <thread>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr std::size_t queue_capacity = 1024;
+constexpr std::uint32_t stream_count = 1u << 22;
+constexpr std::uint32_t ping_count = 1u << 14;
+
+template<typename Queue>
+void push_blocking(Queue& queue, std::uint32_t value) {
+  emb::bench::backoff wait;
+  while (!queue.try_push(value)) {
+    wait.pause();
+  }
+}
+
+template<typename Queue>
+std::uint32_t pop_blocking(Queue& queue) {
+  emb::bench::backoff wait;
+  while (true) {
+    if (auto const value = queue.try_pop()) {
+      return *value;
+    }
+    wait.pause();
+  }
+}
+
+// Million elements per second through one queue.
+template<typename Queue>
+double throughput_mops() {
+  auto queue = std::make_unique<Queue>();
+  std::uint64_t sum = 0;
+
+  auto const start = clock_type::now();
+  std::thread consumer([&] {
+    std::uint64_t local = 0;
+    for (std::uint32_t i = 0; i < stream_count; ++i) {
+      local += pop_blocking(*queue);
+    }
+    sum = local;
+  });
+  for (std::uint32_t i = 0; i < stream_count; ++i) {
+    push_blocking(*queue, i);
+  }
+  consumer.join();
+  auto const stop = clock_type::now();
+
+  emb::bench::do_not_optimize(sum);
+  double const us =
+      std::chrono::duration<double, std::micro>(stop - start).count();
+  return static_cast<double>(stream_count) / us;
+}
+
+// One-way latency in nanoseconds: half of the ping-pong round trip.
+template<typename Queue>
+double latency_ns() {
+  auto ping = std::make_unique<Queue>();
+  auto pong = std::make_unique<Queue>();
+
+  std::thread echo([&] {
+    for (std::uint32_t i = 0; i < ping_count; ++i) {
+      push_blocking(*pong, pop_blocking(*ping));
+    }
+  });
+  auto const start = clock_type::now();
+  for (std::uint32_t i = 0; i < ping_count; ++i) {
+    push_blocking(*ping, i);
+    emb::bench::do_not_optimize(pop_blocking(*pong));
+  }
+  auto const stop = clock_type::now();
+  echo.join();
+
+  double const ns =
+      std::chrono::duration<double, std::nano>(stop - start).count();
+  return ns / (2.0 * ping_count);
+}
+
+template<typename Queue>
+void report(char const* name) {
+  std::printf(
+      "%-24s %12.1f %14.0f\n",
+      name,
+      throughput_mops<Queue>(),
+      latency_ns<Queue>()
+  );
+}
+
+} // namespace
+
+int main() {
+  using isr_queue = emb::isr_spsc_inplace_queue<std::uint32_t, queue_capacity>;
+  using smp_queue = emb::smp_spsc_inplace_queue<std::uint32_t, queue_capacity>;
+
+  std::printf(
+      "hardware threads: %u\n",
+      std::thread::hardware_concurrency()
+  );
+  std::printf("%-24s %12s %14s\n", "queue", "Mops/s", "one-way ns");
+  report<isr_queue>("isr_spsc_inplace_queue");
+  report<smp_queue>("smp_spsc_inplace_queue");
+  return 0;
+}
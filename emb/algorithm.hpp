@@ -1,15 +1,48 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
+#include <type_traits>
 #include <utility>
 
 namespace emb {
 
+namespace detail {
+
+template<class T>
+struct is_lane_array : std::false_type {};
+
+template<class T, std::size_t Lanes>
+struct is_lane_array<std::array<T, Lanes>> : std::true_type {};
+
+// Branchless compare-exchange: afterwards a <= b. The selects compile to
+// min/max (or conditional moves) instead of branches. A std::array operand is
+// treated as independent lanes and ordered lane by lane, so one network
+// evaluates the medians of many channels at once.
+template<class T>
+constexpr void sort2(T& a, T& b) noexcept {
+  if constexpr (is_lane_array<T>::value) {
+    for (std::size_t i = 0; i < a.size(); ++i) {
+      sort2(a[i], b[i]);
+    }
+  } else {
+    T const lo = b < a ? b : a;
+    T const hi = b < a ? a : b;
+    a = lo;
+    b = hi;
+  }
+}
+
+} // namespace detail
+
+// Medians of 3, 5, 7 and 9 via minimal compare-exchange networks: a fixed
+// sequence of min/max operations with no data-dependent branches. T may be a
+// scalar or a std::array of lanes (per-lane median).
 template<class T>
 constexpr T median3(T a, T b, T c) noexcept {
-  if (a > b) std::swap(a, b);
-  if (b > c) std::swap(b, c);
-  if (a > b) std::swap(a, b);
+  detail::sort2(a, b);
+  detail::sort2(b, c);
+  detail::sort2(a, b);
   return b;
 }
 
@@ -18,4 +51,95 @@ constexpr T median3(std::array<T, 3> v) noexcept {
   return median3(v[0], v[1], v[2]);
 }
 
+template<class T>
+constexpr T median5(std::array<T, 5> p) noexcept {
+  detail::sort2(p[0], p[1]);
+  detail::sort2(p[3], p[4]);
+  detail::sort2(p[0], p[3]);
+  detail::sort2(p[1], p[4]);
+  detail::sort2(p[1], p[2]);
+  detail::sort2(p[2], p[3]);
+  detail::sort2(p[1], p[2]);
+  return p[2];
+}
+
+template<class T>
+constexpr T median5(T a, T b, T c, T d, T e) noexcept {
+  return median5(std::array<T, 5>{a, b, c, d, e});
+}
+
+template<class T>
+constexpr T median7(std::array<T, 7> p) noexcept {
+  detail::sort2(p[0], p[5]);
+  detail::sort2(p[0], p[3]);
+  detail::sort2(p[1], p[6]);
+  detail::sort2(p[2], p[4]);
+  detail::sort2(p[0], p[1]);
+  detail::sort2(p[3], p[5]);
+  detail::sort2(p[2], p[6]);
+  detail::sort2(p[2], p[3]);
+  detail::sort2(p[3], p[6]);
+  detail::sort2(p[4], p[5]);
+  detail::sort2(p[1], p[4]);
+  detail::sort2(p[1], p[3]);
+  detail::sort2(p[3], p[4]);
+  return p[3];
+}
+
+template<class T>
+constexpr T median7(T a, T b, T c, T d, T e, T f, T g) noexcept {
+  return median7(std::array<T, 7>{a, b, c, d, e, f, g});
+}
+
+template<class T>
+constexpr T median9(std::array<T, 9> p) noexcept {
+  detail::sort2(p[1], p[2]);
+  detail::sort2(p[4], p[5]);
+  detail::sort2(p[7], p[8]);
+  detail::sort2(p[0], p[1]);
+  detail::sort2(p[3], p[4]);
+  detail::sort2(p[6], p[7]);
+  detail::sort2(p[1], p[2]);
+  detail::sort2(p[4], p[5]);
+  detail::sort2(p[7], p[8]);
+  detail::sort2(p[0], p[3]);
+  detail::sort2(p[5], p[8]);
+  detail::sort2(p[4], p[7]);
+  detail::sort2(p[3], p[6]);
+  detail::sort2(p[1], p[4]);
+  detail::sort2(p[2], p[5]);
+  detail::sort2(p[4], p[7]);
+  detail::sort2(p[4], p[2]);
+  detail::sort2(p[6], p[4]);
+  detail::sort2(p[4], p[2]);
+  return p[4];
+}
+
+template<class T>
+constexpr T median9(T a, T b, T c, T d, T e, T f, T g, T h, T i) noexcept {
+  return median9(std::array<T, 9>{a, b, c, d, e, f, g, h, i});
+}
+
+// True for the window sizes that have a sorting-network median above.
+template<std::size_t N>
+inline constexpr bool has_median_network =
+    N == 1 || N == 3 || N == 5 || N == 7 || N == 9;
+
+// Median of a fixed-size window through the matching network.
+template<class T, std::size_t N>
+  requires has_median_network<N>
+constexpr T median_network(std::array<T, N> const& v) noexcept {
+  if constexpr (N == 1) {
+    return v[0];
+  } else if constexpr (N == 3) {
+    return median3(v);
+  } else if constexpr (N == 5) {
+    return median5(v);
+  } else if constexpr (N == 7) {
+    return median7(v);
+  } else {
+    return median9(v);
+  }
+}
+
 } // namespace emb
@@ -1,8 +1,13 @@
 #pragma once
 
 #include <emb/can.hpp>
+#include <emb/concurrent/isr_mpsc_inplace_queue.hpp>
+#include <emb/concurrent/isr_spsc_inplace_queue.hpp>
 #include <emb/delegate.hpp>
 
+#include <cstddef>
+#include <type_traits>
+
 namespace emb {
 namespace can {
 
@@ -22,5 +27,14 @@ public:
   virtual void add_filter(format_t format, id_t id, id_t mask) = 0;
 };
 
+// Queue between a transport's RX delivery and a protocol's poll loop. SPSC
+// when the transport delivers from one interrupt source; MPSC when several
+// ISRs (e.g. two controllers or RX FIFOs) call the subscribers.
+template<std::size_t Capacity, bool MultiProducer>
+using rx_queue = std::conditional_t<
+    MultiProducer,
+    emb::isr_mpsc_inplace_queue<frame_t, Capacity>,
+    emb::isr_spsc_inplace_queue<frame_t, Capacity>>;
+
 } // namespace can
 } // namespace emb
@@ -8,7 +8,6 @@
 
 #include <emb/can.hpp>
 #include <emb/can/bus.hpp>
-#include <emb/concurrent/isr_spsc_inplace_queue.hpp>
 #include <emb/delegate.hpp>
 
 #include "detail/emcy_producer.hpp"
@@ -31,6 +30,8 @@ struct server_options {
   std::size_t tpdo_count = 4;
   std::size_t rpdo_count = 4;
   std::size_t rx_queue_capacity = 32;
+  // Set when the transport delivers frames from more than one ISR.
+  bool multi_producer_rx = false;
 };
 
 template<server_options Opt>
@@ -221,7 +222,7 @@ private:
 
   transport& bus_;
 
-  emb::isr_spsc_inplace_queue<frame_t, Opt.rx_queue_capacity> rx_queue_;
+  rx_queue<Opt.rx_queue_capacity, Opt.multi_producer_rx> rx_queue_;
 
   detail::nmt_slave<Opt.node_id> nmt_;
   detail::hb_producer<Opt.node_id> hb_producer_;
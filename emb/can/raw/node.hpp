@@ -6,7 +6,6 @@
 #include <emb/assert.hpp>
 #include <emb/can.hpp>
 #include <emb/can/bus.hpp>
-#include <emb/concurrent/isr_spsc_inplace_queue.hpp>
 #include <emb/container/inplace_vector.hpp>
 #include <emb/delegate.hpp>
 
@@ -18,6 +17,8 @@ struct node_options {
   std::size_t rx_slots = 8;
   std::size_t tx_slots = 8;
   std::size_t rx_queue_capacity = 32;
+  // Set when the transport delivers frames from more than one ISR.
+  bool multi_producer_rx = false;
 };
 
 template<node_options Opt>
@@ -146,7 +147,7 @@ private:
   std::chrono::milliseconds now_{0};
   emb::inplace_vector<rx_slot, Opt.rx_slots> rx_;
   emb::inplace_vector<tx_slot, Opt.tx_slots> tx_;
-  emb::isr_spsc_inplace_queue<frame_t, Opt.rx_queue_capacity> rx_queue_;
+  rx_queue<Opt.rx_queue_capacity, Opt.multi_producer_rx> rx_queue_;
 };
 
 } // namespace raw
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <emb/concurrent/detail/atomic_words.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace emb {
+
+// Single-writer / multi-reader broadcast ring: the writer (typically the ADC
+// ISR) stores each sample once and never waits; any number of readers follow
+// it at their own pace through independent reader cursors, reading the
+// samples in place. The ring knows nothing about its readers -- a reader is a
+// small object owned by the consuming subsystem.
+//
+// A reader that falls more than Capacity samples behind is overrun: the
+// samples it missed are counted in lost() and it resumes from the oldest one
+// still held. Because reads are in place, the writer may also overwrite
+// samples while a reader is still looking at them; release() detects that
+// after the fact (seqlock-style) and returns false, and the reader must then
+// discard what it read. Samples are stored and loaded word by word through
+// relaxed atomics (detail::atomic_words), so such a race yields a rejected
+// read, never undefined behavior.
+//
+// Concurrency contract:
+//   - Writer side (one thread/ISR only): push.
+//   - Each reader object is used from one context; readers never contend
+//     with each other or slow down the writer.
+template<typename T, std::size_t Capacity>
+  requires(std::is_trivially_copyable_v<T> && std::has_single_bit(Capacity))
+class broadcast_ring {
+public:
+  using value_type = T;
+  using atomic_index_type = std::atomic_unsigned_lock_free;
+  using index_type = atomic_index_type::value_type;
+  using size_type = std::size_t;
+
+  class reader;
+  class view;
+private:
+  static constexpr size_type capacity_ = Capacity;
+  static constexpr size_type mask_ = Capacity - 1;
+  static_assert(capacity_ <= (index_type(-1) >> 1));
+
+  std::array<detail::atomic_words<value_type>, Capacity> data_{};
+  // Positions below head_ are published. begin_ runs ahead of head_ while a
+  // push is in progress: slots of positions below begin_ - Capacity may be
+  // being overwritten.
+  atomic_index_type head_ = 0;
+  atomic_index_type begin_ = 0;
+public:
+  broadcast_ring() = default;
+  broadcast_ring(broadcast_ring const&) = delete;
+  broadcast_ring& operator=(broadcast_ring const&) = delete;
+
+  [[nodiscard]] size_type capacity() const {
+    return capacity_;
+  }
+
+  // Number of samples written so far, modulo the index width.
+  [[nodiscard]] index_type head() const {
+    return head_.load(std::memory_order::acquire);
+  }
+
+  // Writer-side. Never fails: the oldest sample is overwritten.
+  void push(value_type const& value) {
+    push(std::span<value_type const>(&value, 1));
+  }
+
+  // Writer-side. Stores the samples in order and publishes them at once;
+  // only the last Capacity of them are kept.
+  void push(std::span<value_type const> values) {
+    if (values.empty()) return;
+    if (values.size() > capacity_) {
+      values = values.last(capacity_);
+    }
+    auto const h = head_.load(std::memory_order::relaxed);
+    auto const n = static_cast<index_type>(values.size());
+    begin_.store(h + n, std::memory_order::relaxed);
+    std::atomic_thread_fence(std::memory_order::release);
+
+    for (size_type i = 0; i < values.size(); ++i) {
+      data_[index_of(h + static_cast<index_type>(i))].store(values[i]);
+    }
+
+    head_.store(h + n, std::memory_order::release);
+  }
+
+  // New reader positioned at the current head: it sees samples pushed from
+  // now on.
+  [[nodiscard]] reader subscribe() const {
+    return reader(*this);
+  }
+private:
+  static constexpr size_type index_of(index_type abs_idx) {
+    return size_type(abs_idx) & mask_;
+  }
+};
+
+template<typename T, std::size_t Capacity>
+  requires(std::is_trivially_copyable_v<T> && std::has_single_bit(Capacity))
+class broadcast_ring<T, Capacity>::reader {
+  broadcast_ring const* ring_;
+  index_type cursor_;
+  index_type lost_ = 0;
+public:
+  explicit reader(broadcast_ring const& ring)
+      : ring_(&ring), cursor_(ring.head()) {}
+
+  // Published samples not yet released by this reader, up to Capacity.
+  [[nodiscard]] size_type available() const {
+    auto const pending = index_type(ring_->head() - cursor_);
+    return std::min(size_type(pending), capacity_);
+  }
+
+  // Samples the writer overwrote before this reader got to them, including
+  // those of reads that release() rejected.
+  [[nodiscard]] index_type lost() const {
+    return lost_;
+  }
+
+  // Up to max_count unread samples, oldest first, read in place through the
+  // returned view. If the reader has been overrun it first skips to the
+  // oldest sample still held. release() tells whether what the view returned
+  // stayed valid.
+  [[nodiscard]] view peek(size_type max_count = Capacity) {
+    auto const h = ring_->head_.load(std::memory_order::acquire);
+    resync(h);
+    size_type const count =
+        std::min(size_type(index_type(h - cursor_)), max_count);
+    return view(*ring_, cursor_, count);
+  }
+
+  // Marks the first count peeked samples as read. Returns false if the
+  // writer overwrote any of the peeked samples in the meantime; the reader
+  // has then already skipped past them and the data must be discarded.
+  bool release(size_type count) {
+    std::atomic_thread_fence(std::memory_order::acquire);
+    auto const b = ring_->begin_.load(std::memory_order::relaxed);
+    if (index_type(b - cursor_) > capacity_) {
+      resync(b);
+      return false;
+    }
+    cursor_ += static_cast<index_type>(count);
+    return true;
+  }
+
+  // Copying read: up to out.size() samples into out. Returns the number
+  // copied; 0 when nothing is new or the copy was torn by an overrun.
+  size_type read(std::span<value_type> out) {
+    auto const samples = peek(out.size());
+    size_type const count = samples.size();
+    if (count == 0) return 0;
+    for (size_type i = 0; i < count; ++i) {
+      out[i] = samples[i];
+    }
+    return release(count) ? count : 0;
+  }
+private:
+  // Skips the cursor to the oldest sample still held at writer position
+  // limit, counting what was lost.
+  void resync(index_type limit) {
+    auto const behind = index_type(limit - cursor_);
+    if (behind > capacity_) {
+      auto const skipped = static_cast<index_type>(behind - capacity_);
+      lost_ += skipped;
+      cursor_ += skipped;
+    }
+  }
+};
+
+// Peeked samples of a reader. Each element is loaded from the ring when
+// accessed; what it returns is only valid once release() has accepted it.
+template<typename T, std::size_t Capacity>
+  requires(std::is_trivially_copyable_v<T> && std::has_single_bit(Capacity))
+class broadcast_ring<T, Capacity>::view {
+  broadcast_ring const* ring_;
+  index_type start_;
+  size_type size_;
+
+  view(broadcast_ring const& ring, index_type start, size_type size)
+      : ring_(&ring), start_(start), size_(size) {}
+  friend class broadcast_ring::reader;
+public:
+  [[nodiscard]] size_type size() const {
+    return size_;
+  }
+
+  [[nodiscard]] bool empty() const {
+    return size_ == 0;
+  }
+
+  // i-th peeked sample, oldest first.
+  [[nodiscard]] value_type operator[](size_type i) const {
+    return ring_->data_[index_of(start_ + static_cast<index_type>(i))].load();
+  }
+};
+
+} // namespace emb
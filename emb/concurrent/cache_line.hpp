@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstddef>
+
+namespace emb {
+
+// Alignment that keeps independently written state on separate cache lines
+// (64 bytes on x86-64, Cortex-A and most SMP MCUs). A fixed value rather than
+// std::hardware_destructive_interference_size, which may differ between
+// translation units built with different tuning flags and so must not appear
+// in a header-defined layout.
+inline constexpr std::size_t cache_line_size = 64;
+
+} // namespace emb
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace emb::detail {
+
+// Storage for a trivially copyable T that is read and written word by word
+// through relaxed std::atomic_ref. Concurrent store/load of the same object
+// are then not a data race: a load racing a store may return a mix of old
+// and new words -- which the enclosing protocol (sequence counter, buffer
+// index) detects or rules out -- but never undefined behavior, and thread
+// sanitizers see ordinary atomics.
+template<typename T>
+  requires std::is_trivially_copyable_v<T>
+class atomic_words {
+  using native_word_type = std::atomic_unsigned_lock_free::value_type;
+
+  // The widest power of two that divides sizeof(T), up to the native
+  // lock-free word: no padding, so arrays of small samples stay dense.
+  static constexpr std::size_t word_size = std::min(
+      sizeof(native_word_type),
+      sizeof(T) & (~sizeof(T) + 1)
+  );
+
+  using word_type = std::conditional_t<
+      word_size == sizeof(native_word_type),
+      native_word_type,
+      std::conditional_t<
+          word_size == 4,
+          std::uint32_t,
+          std::conditional_t<word_size == 2, std::uint16_t, std::uint8_t>>>;
+  static_assert(std::atomic_ref<word_type>::is_always_lock_free);
+
+  static constexpr std::size_t word_count =
+      (sizeof(T) + sizeof(word_type) - 1) / sizeof(word_type);
+
+  alignas(std::atomic_ref<word_type>::required_alignment)
+      mutable std::array<word_type, word_count> words_{};
+public:
+  void store(T const& value) {
+    std::array<word_type, word_count> staged{};
+    std::memcpy(staged.data(), &value, sizeof(T));
+    for (std::size_t i = 0; i < word_count; ++i) {
+      std::atomic_ref<word_type>(words_[i])
+          .store(staged[i], std::memory_order::relaxed);
+    }
+  }
+
+  T load() const {
+    std::array<word_type, word_count> staged;
+    for (std::size_t i = 0; i < word_count; ++i) {
+      staged[i] = std::atomic_ref<word_type>(words_[i])
+                      .load(std::memory_order::relaxed);
+    }
+    T value;
+    std::memcpy(&value, staged.data(), sizeof(T));
+    return value;
+  }
+};
+
+} // namespace emb::detail
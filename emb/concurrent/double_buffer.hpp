@@ -8,6 +8,7 @@ namespace emb {
 // Wait-free double buffer for single-writer / multi-reader
 //
 // Invariant: writer must not commit more than once during a single load().
+// Single-core only (signal fences); see smp_double_buffer for multi-core.
 template <typename T>
   requires(std::is_trivially_copyable_v<T>)
 class double_buffer {
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <utility>
+
+#ifdef __arm__
+extern "C" {
+#include "cmsis_compiler.h"
+}
+#endif
+
+namespace emb {
+
+// Wait policies for event_flags. wait(word, observed) blocks while word still
+// holds observed and may return spuriously -- the contract of
+// std::atomic::wait; notify(word) wakes waiters after a change.
+template<typename W>
+concept some_event_wait = requires(
+    std::atomic_unsigned_lock_free& word,
+    std::atomic_unsigned_lock_free::value_type observed
+) {
+  W::wait(std::as_const(word), observed);
+  W::notify(word);
+};
+
+// Busy polling: wait() returns at once and the caller re-checks. Needs
+// nothing from the platform; notify() is empty.
+struct spin_event_wait {
+  static void wait(
+      std::atomic_unsigned_lock_free const&,
+      std::atomic_unsigned_lock_free::value_type
+  ) {}
+
+  static void notify(std::atomic_unsigned_lock_free&) {}
+};
+
+// Blocks in std::atomic::wait (a futex on Linux) until a setter notifies.
+// For threads on a hosted system; notify() is a system call there, so not
+// for setters that must stay wait-free.
+struct atomic_event_wait {
+  static void wait(
+      std::atomic_unsigned_lock_free const& word,
+      std::atomic_unsigned_lock_free::value_type observed
+  ) {
+    word.wait(observed, std::memory_order::relaxed);
+  }
+
+  static void notify(std::atomic_unsigned_lock_free& word) {
+    word.notify_all();
+  }
+};
+
+#ifdef __arm__
+// Cortex-M: sleeps in WFI with interrupts masked, so an ISR that fires between
+// the check and the sleep stays pending and still wakes the core; it runs
+// once the previous PRIMASK is restored. For the main loop, with setters in
+// interrupt handlers; notify() is empty, as any interrupt ends the WFI.
+struct wfi_event_wait {
+  static void wait(
+      std::atomic_unsigned_lock_free const& word,
+      std::atomic_unsigned_lock_free::value_type observed
+  ) {
+    auto const primask = __get_PRIMASK();
+    __disable_irq();
+    if (word.load(std::memory_order::relaxed) == observed) {
+      __WFI();
+    }
+    __set_PRIMASK(primask);
+  }
+
+  static void notify(std::atomic_unsigned_lock_free&) {}
+};
+#endif
+
+// Group of event bits shared between interrupt handlers (or threads) that
+// signal and one main loop that services them. set() is a single atomic OR
+// plus the policy's notify; take() fetches and clears in one operation, so
+// no event set concurrently is lost -- it is either returned now or stays
+// set for the next take(). Release/acquire ordering makes data written
+// before set() visible to the context that takes the bit.
+//
+// Typical main loop:
+//   for (;;) {
+//     auto const events = flags.wait();
+//     if (events & can_rx) server.run();
+//     if (events & adc_ready) sensor.process();
+//   }
+//
+// Requires atomic read-modify-write (LDREX/STREX on ARMv7-M and up).
+template<some_event_wait Wait = spin_event_wait>
+class event_flags {
+public:
+  using mask_type = std::atomic_unsigned_lock_free::value_type;
+  static constexpr mask_type all = mask_type(-1);
+private:
+  std::atomic_unsigned_lock_free bits_ = 0;
+public:
+  event_flags() = default;
+  event_flags(event_flags const&) = delete;
+  event_flags& operator=(event_flags const&) = delete;
+
+  // Any context.
+  void set(mask_type mask) {
+    bits_.fetch_or(mask, std::memory_order::release);
+    Wait::notify(bits_);
+  }
+
+  // Any context. Drops pending events without servicing them.
+  void clear(mask_type mask) {
+    bits_.fetch_and(~mask, std::memory_order::relaxed);
+  }
+
+  // Pending events; an advisory snapshot.
+  [[nodiscard]] mask_type peek() const {
+    return bits_.load(std::memory_order::relaxed);
+  }
+
+  // Clears the pending events in mask and returns those of them that were
+  // set.
+  mask_type take(mask_type mask = all) {
+    if (mask == all) {
+      return bits_.exchange(0, std::memory_order::acquire);
+    }
+    return bits_.fetch_and(~mask, std::memory_order::acquire) & mask;
+  }
+
+  // Waits through the policy until any event in mask is pending, then takes
+  // the pending events in mask. With spin_event_wait this polls.
+  mask_type wait(mask_type mask = all) {
+    for (;;) {
+      auto const observed = bits_.load(std::memory_order::relaxed);
+      if (observed & mask) {
+        return take(mask);
+      }
+      Wait::wait(bits_, observed);
+    }
+  }
+};
+
+} // namespace emb
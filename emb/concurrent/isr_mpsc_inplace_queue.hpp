@@ -0,0 +1,230 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace emb {
+
+// Lock-free multi-producer / single-consumer queue for ISR context: several
+// interrupt handlers (of any priorities, nesting allowed) and threads push,
+// one context pops. No critical sections, no allocation.
+//
+// Every slot carries a sequence number. A producer claims the back position
+// with a compare-exchange, constructs the element in its slot, then publishes
+// it by advancing the slot's sequence; the consumer takes the front slot once
+// its sequence says it has been published. A producer preempted between claim
+// and publish holds back only the elements queued behind its slot, until it
+// resumes -- try_pop reports empty meanwhile, it never blocks.
+//
+// Requires atomic compare-exchange (LDREX/STREX on ARMv7-M and up); on
+// ARMv6-M use one isr_spsc_inplace_queue per producer instead.
+//
+// Concurrency contract:
+//   - Producer side (any number of threads/ISRs): try_push, try_emplace.
+//   - Consumer side (one thread/ISR only): try_pop, drain, clear.
+//   - Observers are advisory snapshots; size() counts claimed slots, which
+//     includes elements still being constructed.
+template<typename T, std::size_t Capacity>
+  requires(std::has_single_bit(Capacity))
+class isr_mpsc_inplace_queue {
+public:
+  using value_type = T;
+  using atomic_index_type = std::atomic_unsigned_lock_free;
+  using size_type = std::size_t;
+  using reference = value_type&;
+  using const_reference = value_type const&;
+  using pointer = value_type*;
+  using const_pointer = value_type const*;
+
+private:
+  using index_type = atomic_index_type::value_type;
+  using difference_type = std::make_signed_t<index_type>;
+
+  struct no_value_t {};
+  union slot {
+    no_value_t no_value;
+    value_type value;
+    constexpr slot() : no_value{} {}
+    constexpr ~slot()
+      requires std::is_trivially_destructible_v<T>
+    = default;
+    constexpr ~slot()
+      requires(!std::is_trivially_destructible_v<T>) {}
+  };
+
+  static constexpr size_type capacity_ = Capacity;
+  static constexpr size_type mask_ = Capacity - 1;
+
+  // Slot i holds absolute position p (p & mask == i) in three phases:
+  //   sequence == p        free, may be claimed by the producer of p
+  //   sequence == p + 1    published, may be popped
+  //   sequence == p + Cap  popped, free for position p + Cap
+  std::array<atomic_index_type, Capacity> sequence_;
+  std::array<slot, Capacity> data_{};
+  atomic_index_type back_ = 0;
+  atomic_index_type front_ = 0;
+
+public:
+  isr_mpsc_inplace_queue() {
+    for (size_type i = 0; i < capacity_; ++i) {
+      sequence_[i].store(index_type(i), std::memory_order::relaxed);
+    }
+  }
+
+  isr_mpsc_inplace_queue(isr_mpsc_inplace_queue const&) = delete;
+  isr_mpsc_inplace_queue(isr_mpsc_inplace_queue&&) = delete;
+  isr_mpsc_inplace_queue& operator=(isr_mpsc_inplace_queue const&) = delete;
+  isr_mpsc_inplace_queue& operator=(isr_mpsc_inplace_queue&&) = delete;
+
+  ~isr_mpsc_inplace_queue()
+    requires(std::is_trivially_destructible_v<T>)
+  = default;
+
+  ~isr_mpsc_inplace_queue()
+    requires(!std::is_trivially_destructible_v<T>) {
+    clear();
+  }
+
+  // Consumer-side. Destroys every published element at the front.
+  void clear() {
+    drain([](std::span<value_type const>) {});
+  }
+
+  [[nodiscard]] bool empty() const {
+    return size() == 0;
+  }
+
+  [[nodiscard]] bool full() const {
+    return size() == capacity_;
+  }
+
+  [[nodiscard]] size_type capacity() const {
+    return capacity_;
+  }
+
+  [[nodiscard]] size_type size() const {
+    auto const f = front_.load(std::memory_order::acquire);
+    auto const b = back_.load(std::memory_order::acquire);
+    return size_type(index_type(b - f));
+  }
+
+  // Producer-side. Returns false if the queue is full.
+  [[nodiscard]] bool try_push(value_type const& value)
+    requires std::is_copy_constructible_v<T> {
+    return try_emplace(value);
+  }
+
+  [[nodiscard]] bool try_push(value_type&& value)
+    requires std::is_move_constructible_v<T> {
+    return try_emplace(std::move(value));
+  }
+
+  template<typename... Args>
+  [[nodiscard]] bool try_emplace(Args&&... args)
+    requires std::is_constructible_v<T, Args...> {
+    auto b = back_.load(std::memory_order::relaxed);
+    while (true) {
+      auto const seq = sequence_[index_of(b)].load(std::memory_order::acquire);
+      auto const lag = static_cast<difference_type>(seq - b);
+      if (lag == 0) {
+        // On failure b is reloaded and the claim retried.
+        if (back_.compare_exchange_weak(
+                b,
+                b + 1,
+                std::memory_order::relaxed,
+                std::memory_order::relaxed
+            )) {
+          break;
+        }
+      } else if (lag < 0) {
+        return false; // slot not yet popped for this lap: full
+      } else {
+        b = back_.load(std::memory_order::relaxed);
+      }
+    }
+    auto const idx = index_of(b);
+    std::construct_at(slot_ptr(idx), std::forward<Args>(args)...);
+    sequence_[idx].store(b + 1, std::memory_order::release);
+    return true;
+  }
+
+  // Consumer-side. Removes and returns the head element, or nullopt if the
+  // head is empty or not yet published.
+  [[nodiscard]] std::optional<value_type> try_pop()
+    requires std::is_move_constructible_v<T> {
+    auto const f = front_.load(std::memory_order::relaxed);
+    auto const idx = index_of(f);
+    if (sequence_[idx].load(std::memory_order::acquire) != index_type(f + 1)) {
+      return std::nullopt;
+    }
+    std::optional<value_type> result{std::move(*slot_ptr(idx))};
+    destroy_slot(idx);
+    sequence_[idx].store(
+        index_type(f + capacity_),
+        std::memory_order::release
+    );
+    front_.store(f + 1, std::memory_order::release);
+    return result;
+  }
+
+  // Consumer-side. Hands the run of published head elements (up to
+  // max_count) to consumer as at most two contiguous spans, as in
+  // isr_spsc_inplace_queue::drain, then frees their slots. The run stops at
+  // the first slot still being written. Returns the number consumed.
+  template<typename F>
+    requires std::invocable<F&, std::span<value_type const>>
+  size_type drain(F&& consumer, size_type max_count = Capacity) {
+    auto const f = front_.load(std::memory_order::relaxed);
+    size_type count = 0;
+    while (count < std::min(max_count, capacity_)
+           && sequence_[index_of(f + count)].load(std::memory_order::acquire)
+                  == index_type(f + count + 1)) {
+      ++count;
+    }
+    if (count == 0) return 0;
+
+    auto const f_idx = index_of(f);
+    size_type const head = std::min(count, capacity_ - f_idx);
+    consumer(std::span<value_type const>(slot_ptr(f_idx), head));
+    if (head < count) {
+      consumer(std::span<value_type const>(slot_ptr(0), count - head));
+    }
+
+    for (size_type i = 0; i < count; ++i) {
+      auto const idx = index_of(f + i);
+      destroy_slot(idx);
+      sequence_[idx].store(
+          index_type(f + i + capacity_),
+          std::memory_order::release
+      );
+    }
+    front_.store(index_type(f + count), std::memory_order::release);
+    return count;
+  }
+
+private:
+  static constexpr size_type index_of(index_type abs_idx) {
+    return size_type(abs_idx) & mask_;
+  }
+
+  constexpr pointer slot_ptr(size_type i) {
+    return &data_[i].value;
+  }
+
+  constexpr void destroy_slot(size_type i) {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      std::destroy_at(slot_ptr(i));
+    }
+  }
+};
+
+} // namespace emb
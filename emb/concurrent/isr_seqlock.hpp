@@ -9,7 +9,8 @@ namespace emb {
 
 // Lock-free primitive for sharing data between ISR and thread context
 // (or between two priority levels) without disabling interrupts.
-// Uses signal fences — not suitable for multi-core (SMP) systems.
+// Uses signal fences — not suitable for multi-core (SMP) systems; see
+// seqlock for the multi-core variant.
 // Constraints:
 //   - exactly one writer, multiple writers need separate mutual exclusion
 //   - reader priority must not be higher than writer priority
@@ -2,9 +2,12 @@
 
 #include <array>
 #include <atomic>
+#include <algorithm>
 #include <bit>
+#include <concepts>
 #include <memory>
 #include <optional>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -13,8 +16,10 @@ namespace emb {
 // Lock-free single-producer / single-consumer queue for ISR context.
 //
 // Concurrency contract:
-//   - Producer side (one thread/ISR only): try_push, try_emplace.
-//   - Consumer side (one thread/ISR only): try_pop, front, clear.
+//   - Producer side (one thread/ISR only): try_push, try_emplace,
+//     reserve, commit.
+//   - Consumer side (one thread/ISR only): try_pop, drain, peek, release,
+//     front, clear.
 //   - Producer and consumer may run concurrently; two producers or
 //     two consumers may not.
 //
@@ -126,6 +131,65 @@ public:
     return true;
   }
 
+  // Producer-side, zero-copy. reserve() returns the uninitialized slot at the
+  // back (nullptr when full); construct the element there -- for a trivially
+  // copyable T plain writes will do, e.g. straight from a mailbox -- and then
+  // commit() makes it visible to the consumer. The batch form returns up to
+  // max_count contiguous free slots, fewer when the free space wraps around
+  // the end of the storage; commit(count) publishes the first count of them.
+  [[nodiscard]] pointer reserve() {
+    auto const b = back_.load(std::memory_order::relaxed);
+    if (b - front_.load(std::memory_order::acquire) == capacity_) {
+      return nullptr;
+    }
+    return slot_ptr(index_of(b));
+  }
+
+  [[nodiscard]] std::span<value_type> reserve(size_type max_count) {
+    auto const b = back_.load(std::memory_order::relaxed);
+    auto const f = front_.load(std::memory_order::acquire);
+    auto const b_idx = index_of(b);
+    size_type const count = std::min(
+        {max_count, capacity_ - size_type(b - f), capacity_ - b_idx}
+    );
+    return std::span<value_type>(slot_ptr(b_idx), count);
+  }
+
+  void commit(size_type count = 1) {
+    auto const b = back_.load(std::memory_order::relaxed);
+    back_.store(b + count, std::memory_order::release);
+  }
+
+  // Consumer-side, zero-copy. peek() returns the head element in place
+  // (nullptr when empty); the consumer may read or move from it, then
+  // release() destroys it and frees the slot. The batch form returns up to
+  // max_count contiguous head elements, fewer when they wrap around the end
+  // of the storage; release(count) frees the first count of them.
+  [[nodiscard]] pointer peek() {
+    auto const f = front_.load(std::memory_order::relaxed);
+    if (f == back_.load(std::memory_order::acquire)) return nullptr;
+    return slot_ptr(index_of(f));
+  }
+
+  [[nodiscard]] std::span<value_type> peek(size_type max_count) {
+    auto const f = front_.load(std::memory_order::relaxed);
+    auto const b = back_.load(std::memory_order::acquire);
+    auto const f_idx = index_of(f);
+    size_type const count =
+        std::min({max_count, size_type(b - f), capacity_ - f_idx});
+    return std::span<value_type>(slot_ptr(f_idx), count);
+  }
+
+  void release(size_type count = 1) {
+    auto const f = front_.load(std::memory_order::relaxed);
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      for (size_type i = 0; i < count; ++i) {
+        destroy_slot(index_of(f + i));
+      }
+    }
+    front_.store(f + count, std::memory_order::release);
+  }
+
   // Consumer-side. Non-destructive peek at the head; returns a copy.
   [[nodiscard]] std::optional<value_type> front() const
     requires std::is_copy_constructible_v<T> {
@@ -146,6 +210,35 @@ public:
     return result;
   }
 
+  // Consumer-side. Hands up to max_count head elements to consumer as at
+  // most two contiguous spans (two only when the run wraps around the end of
+  // the storage), then destroys them and publishes the new front with a
+  // single release store. Elements pushed meanwhile are left for the next
+  // call. Returns the number of elements consumed.
+  template<typename F>
+    requires std::invocable<F&, std::span<value_type const>>
+  size_type drain(F&& consumer, size_type max_count = Capacity) {
+    auto const f = front_.load(std::memory_order::relaxed);
+    auto const b = back_.load(std::memory_order::acquire);
+    size_type const count = std::min(size_type(b - f), max_count);
+    if (count == 0) return 0;
+
+    auto const f_idx = index_of(f);
+    size_type const head = std::min(count, capacity_ - f_idx);
+    consumer(std::span<value_type const>(slot_ptr(f_idx), head));
+    if (head < count) {
+      consumer(std::span<value_type const>(slot_ptr(0), count - head));
+    }
+
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      for (size_type i = 0; i < count; ++i) {
+        destroy_slot(index_of(f + i));
+      }
+    }
+    front_.store(f + count, std::memory_order::release);
+    return count;
+  }
+
 private:
   constexpr size_type index_of(atomic_index_type::value_type abs_idx) const {
     return size_type(abs_idx) & mask_;
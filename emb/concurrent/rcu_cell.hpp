@@ -0,0 +1,202 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace emb {
+
+// Read-copy-update cell for large, read-mostly objects (controller settings,
+// gain tables): readers access the current version in place through a guard,
+// without copying it; the writer builds each new version in a free slot of a
+// static pool of Slots versions and publishes it by switching an index.
+// Versions are immutable once published, and T need not be trivially
+// copyable.
+//
+// A guard pins its version with a per-slot reader count, so a slow reader
+// keeps the version it started with while newer ones are published. The
+// writer reclaims (destroys) a retired version once its count drops to zero;
+// this happens in the writer's context, on the next publication or reclaim(),
+// never in a reader. With more guards alive at once than Slots - 1, every
+// non-current slot may be pinned and a publication fails until one is
+// released.
+//
+// Requires atomic read-modify-write (LDREX/STREX on ARMv7-M and up).
+//
+// Concurrency contract:
+//   - Writer side (one thread/ISR only): try_publish, try_emplace,
+//     try_update, reclaim, latest.
+//   - Reader side (any number, any context): read. A guard is used and
+//     destroyed in the context that created it.
+template<typename T, std::size_t Slots>
+  requires(Slots >= 2)
+class rcu_cell {
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  class guard;
+private:
+  struct no_value_t {};
+  union slot {
+    no_value_t no_value;
+    value_type value;
+    constexpr slot() : no_value{} {}
+    constexpr ~slot()
+      requires std::is_trivially_destructible_v<T>
+    = default;
+    constexpr ~slot()
+      requires(!std::is_trivially_destructible_v<T>) {}
+  };
+
+  std::array<slot, Slots> data_{};
+  // Guards holding each slot, plus transient counts of readers that are
+  // still checking whether the slot is current.
+  std::array<std::atomic_unsigned_lock_free, Slots> mutable readers_{};
+  std::atomic<size_type> current_ = 0;
+  // Writer-only: which slots hold a constructed version.
+  std::array<bool, Slots> live_{};
+public:
+  explicit rcu_cell(value_type const& initial)
+    requires std::is_copy_constructible_v<T>
+      : rcu_cell(std::in_place, initial) {}
+
+  template<typename... Args>
+    requires std::is_constructible_v<T, Args...>
+  explicit rcu_cell(std::in_place_t, Args&&... args) {
+    std::construct_at(&data_[0].value, std::forward<Args>(args)...);
+    live_[0] = true;
+  }
+
+  rcu_cell(rcu_cell const&) = delete;
+  rcu_cell& operator=(rcu_cell const&) = delete;
+
+  ~rcu_cell()
+    requires(std::is_trivially_destructible_v<T>)
+  = default;
+
+  ~rcu_cell()
+    requires(!std::is_trivially_destructible_v<T>) {
+    for (size_type i = 0; i < Slots; ++i) {
+      if (live_[i]) {
+        std::destroy_at(&data_[i].value);
+      }
+    }
+  }
+
+  // Reader-side. Pins the current version for the lifetime of the guard.
+  // Lock-free: retries only when a publication lands in between.
+  [[nodiscard]] guard read() const {
+    for (;;) {
+      auto const idx = current_.load(std::memory_order::seq_cst);
+      readers_[idx].fetch_add(1, std::memory_order::seq_cst);
+      if (current_.load(std::memory_order::seq_cst) == idx) {
+        return guard(*this, idx);
+      }
+      readers_[idx].fetch_sub(1, std::memory_order::release);
+    }
+  }
+
+  // Writer-side. The current version; the writer needs no guard since only
+  // it retires versions.
+  [[nodiscard]] value_type const& latest() const {
+    return data_[current_.load(std::memory_order::relaxed)].value;
+  }
+
+  // Writer-side. Publishes a copy of value. Returns false if every other
+  // slot is still held by readers.
+  [[nodiscard]] bool try_publish(value_type const& value)
+    requires std::is_copy_constructible_v<T> {
+    return try_emplace(value);
+  }
+
+  [[nodiscard]] bool try_publish(value_type&& value)
+    requires std::is_move_constructible_v<T> {
+    return try_emplace(std::move(value));
+  }
+
+  template<typename... Args>
+  [[nodiscard]] bool try_emplace(Args&&... args)
+    requires std::is_constructible_v<T, Args...> {
+    reclaim();
+    auto const cur = current_.load(std::memory_order::relaxed);
+    for (size_type i = 0; i < Slots; ++i) {
+      if (i == cur || live_[i]) continue;
+      std::construct_at(&data_[i].value, std::forward<Args>(args)...);
+      live_[i] = true;
+      current_.store(i, std::memory_order::seq_cst);
+      return true;
+    }
+    return false;
+  }
+
+  // Writer-side. Publishes f(latest()), built directly in the free slot.
+  template<typename F>
+    requires std::is_invocable_r_v<T, F&, T const&>
+  [[nodiscard]] bool try_update(F&& f) {
+    struct from_latest {
+      F& f;
+      value_type const& latest;
+      operator value_type() const {
+        return f(latest);
+      }
+    };
+    return try_emplace(from_latest{f, latest()});
+  }
+
+  // Writer-side. Destroys the retired versions no reader holds any more.
+  // Returns the number of free slots.
+  size_type reclaim() {
+    auto const cur = current_.load(std::memory_order::relaxed);
+    size_type free = 0;
+    for (size_type i = 0; i < Slots; ++i) {
+      if (i == cur) continue;
+      if (live_[i] && readers_[i].load(std::memory_order::seq_cst) == 0) {
+        std::destroy_at(&data_[i].value);
+        live_[i] = false;
+      }
+      free += !live_[i];
+    }
+    return free;
+  }
+};
+
+template<typename T, std::size_t Slots>
+  requires(Slots >= 2)
+class rcu_cell<T, Slots>::guard {
+  rcu_cell const* cell_;
+  size_type idx_;
+
+  guard(rcu_cell const& cell, size_type idx) : cell_(&cell), idx_(idx) {}
+  friend class rcu_cell;
+public:
+  guard(guard&& other) noexcept
+      : cell_(std::exchange(other.cell_, nullptr)), idx_(other.idx_) {}
+
+  guard(guard const&) = delete;
+  guard& operator=(guard const&) = delete;
+  guard& operator=(guard&&) = delete;
+
+  ~guard() {
+    if (cell_) {
+      cell_->readers_[idx_].fetch_sub(1, std::memory_order::release);
+    }
+  }
+
+  value_type const& operator*() const {
+    return cell_->data_[idx_].value;
+  }
+
+  value_type const* operator->() const {
+    return &cell_->data_[idx_].value;
+  }
+
+  value_type const* get() const {
+    return &cell_->data_[idx_].value;
+  }
+};
+
+} // namespace emb
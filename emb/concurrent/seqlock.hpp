@@ -1,8 +1,10 @@
 #pragma once
 
+#include <emb/concurrent/detail/atomic_words.hpp>
+
 #include <atomic>
 #include <cstdint>
-#include <cstring>
+#include <optional>
 #include <type_traits>
 #include <utility>
 
@@ -10,15 +12,19 @@ namespace emb {
 
 // Lock-free primitive for sharing data between threads without blocking.
 // Uses atomic operations with release/acquire ordering —
-// safe on multi-core (SMP) systems.
+// safe on multi-core (SMP) systems; the multi-core counterpart of
+// isr_seqlock with the same store/update/load surface. The payload is
+// accessed through std::atomic_ref words, so a read racing the writer is
+// retried rather than being a data race.
 // Constraints:
 //   - exactly one writer, multiple writers need separate mutual exclusion
 //   - readers retry while the writer is active (not wait-free)
+//   - holds only the latest value; seqlock_ring keeps a history
 template <typename T>
   requires(std::is_trivially_copyable_v<T>)
 class seqlock {
   std::atomic<std::uint32_t> seq_ = 0;
-  T value_{};
+  detail::atomic_words<T> value_{};
 public:
   seqlock() = default;
   seqlock(seqlock const&) = delete;
@@ -28,7 +34,7 @@ public:
     std::uint32_t const s = seq_.load(std::memory_order::relaxed);
     seq_.store(s + 1, std::memory_order::relaxed);
     std::atomic_thread_fence(std::memory_order::release);
-    std::memcpy(&value_, &desired, sizeof(T));
+    value_.store(desired);
     seq_.store(s + 2, std::memory_order::release);
   }
 
@@ -37,26 +43,30 @@ public:
     std::uint32_t const s = seq_.load(std::memory_order::relaxed);
     seq_.store(s + 1, std::memory_order::relaxed);
     std::atomic_thread_fence(std::memory_order::release);
-    T snapshot;
-    std::memcpy(&snapshot, &value_, sizeof(T));
-    T desired = std::forward<F>(f)(snapshot);
-    std::memcpy(&value_, &desired, sizeof(T));
+    value_.store(std::forward<F>(f)(value_.load()));
     seq_.store(s + 2, std::memory_order::release);
   }
 
   T load() const {
-    T snapshot;
-    std::uint32_t s1, s2;
-    for(;;) {
-      s1 = seq_.load(std::memory_order::acquire);
-      if (s1 & 1) {
-        continue;
-      }
-      std::memcpy(&snapshot, &value_, sizeof(T));
-      std::atomic_thread_fence(std::memory_order::acquire);
-      s2 = seq_.load(std::memory_order::relaxed);
-      if (s1 == s2) return snapshot;
+    for (;;) {
+      if (auto const snapshot = try_load()) return *snapshot;
+    }
+  }
+
+  // Single read attempt: nullopt if it overlapped a store. For readers that
+  // must not spin on a busy writer, or that count their retries.
+  std::optional<T> try_load() const {
+    std::uint32_t const s1 = seq_.load(std::memory_order::acquire);
+    if (s1 & 1) {
+      return std::nullopt;
+    }
+    T const snapshot = value_.load();
+    std::atomic_thread_fence(std::memory_order::acquire);
+    std::uint32_t const s2 = seq_.load(std::memory_order::relaxed);
+    if (s1 != s2) {
+      return std::nullopt;
     }
+    return snapshot;
   }
 };
 
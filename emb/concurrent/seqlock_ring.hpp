@@ -0,0 +1,130 @@
+#pragma once
+
+#include <emb/concurrent/detail/atomic_words.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+namespace emb {
+
+// History of the last Capacity values of a single writer, each guarded like a
+// seqlock: the writer appends without ever waiting, readers on any core copy
+// out entries and verify them afterwards. Every value gets a sequence number
+// (its position in the writer's stream), so a reader can tell exactly which
+// entries it holds.
+//
+// A reader slower than the writer loses the entries overwritten while it was
+// copying them: they are left out of the result rather than retried, and show
+// up as gaps in the sequence numbers. Entries older than Capacity are gone in
+// the same way.
+//
+// Concurrency contract:
+//   - Writer side (one thread/ISR only): push.
+//   - Reader side (any number, any core): head, read, read_last.
+template<typename T, std::size_t Capacity>
+  requires(std::is_trivially_copyable_v<T> && std::has_single_bit(Capacity))
+class seqlock_ring {
+public:
+  using value_type = T;
+  using sequence_type = std::uint32_t;
+  using size_type = std::size_t;
+
+  struct entry {
+    sequence_type sequence;
+    value_type value;
+  };
+private:
+  static constexpr size_type capacity_ = Capacity;
+  static constexpr size_type mask_ = Capacity - 1;
+  static_assert(capacity_ <= (sequence_type(-1) >> 2));
+
+  // stamp is 2 * sequence + 1 while the entry is being written and
+  // 2 * sequence + 2 once it is committed. It starts odd, so a slot that was
+  // never written matches no sequence number.
+  struct slot {
+    std::atomic<sequence_type> stamp = 1;
+    detail::atomic_words<value_type> value{};
+  };
+
+  std::array<slot, Capacity> slots_{};
+  std::atomic<sequence_type> head_ = 0;
+public:
+  seqlock_ring() = default;
+  seqlock_ring(seqlock_ring const&) = delete;
+  seqlock_ring& operator=(seqlock_ring const&) = delete;
+
+  [[nodiscard]] size_type capacity() const {
+    return capacity_;
+  }
+
+  // Sequence number the next push will get, i.e. the number of values
+  // pushed so far (modulo 2^32).
+  [[nodiscard]] sequence_type head() const {
+    return head_.load(std::memory_order::acquire);
+  }
+
+  // Writer-side. Never fails: the oldest entry is overwritten.
+  void push(value_type const& value) {
+    auto const seq = head_.load(std::memory_order::relaxed);
+    auto& s = slots_[index_of(seq)];
+    s.stamp.store(2 * seq + 1, std::memory_order::relaxed);
+    std::atomic_thread_fence(std::memory_order::release);
+    s.value.store(value);
+    s.stamp.store(2 * seq + 2, std::memory_order::release);
+    head_.store(seq + 1, std::memory_order::release);
+  }
+
+  // The value with the given sequence number, or nullopt if it has not been
+  // pushed yet, has already been overwritten, or was overwritten while being
+  // copied.
+  [[nodiscard]] std::optional<value_type> read(sequence_type seq) const {
+    if (sequence_type(head() - seq - 1) >= capacity_) {
+      return std::nullopt;
+    }
+    return read_slot(seq);
+  }
+
+  // Copies the newest out.size() entries (at most Capacity), oldest first,
+  // into the front of out and returns how many it copied. Entries not pushed
+  // yet or lost to the writer during the copy are skipped, the latter
+  // leaving gaps in the sequence numbers; an uninterrupted result is
+  // contiguous and ends at head() - 1 as of the call.
+  size_type read_last(std::span<entry> out) const {
+    auto const h = head();
+    size_type const count = std::min(out.size(), capacity_);
+    size_type copied = 0;
+    for (auto seq = sequence_type(h - count); seq != h; ++seq) {
+      if (auto const value = read_slot(seq)) {
+        out[copied++] = entry{seq, *value};
+      }
+    }
+    return copied;
+  }
+private:
+  static constexpr size_type index_of(sequence_type seq) {
+    return size_type(seq) & mask_;
+  }
+
+  std::optional<value_type> read_slot(sequence_type seq) const {
+    auto const& s = slots_[index_of(seq)];
+    auto const committed = sequence_type(2 * seq + 2);
+    if (s.stamp.load(std::memory_order::acquire) != committed) {
+      return std::nullopt;
+    }
+    value_type const snapshot = s.value.load();
+    std::atomic_thread_fence(std::memory_order::acquire);
+    if (s.stamp.load(std::memory_order::relaxed) != committed) {
+      return std::nullopt;
+    }
+    return snapshot;
+  }
+};
+
+} // namespace emb
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <emb/concurrent/detail/atomic_words.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace emb {
+
+// Multi-core counterpart of double_buffer: wait-free single-writer /
+// multi-reader, usable with the writer and readers on different cores.
+// The published index is a release/acquire atomic instead of a volatile with
+// signal fences, and the buffers are accessed through std::atomic_ref words
+// (detail::atomic_words), so the hand-over is ordered across cores and free
+// of data races.
+//
+// Invariant (as for double_buffer): the writer must not commit more than
+// once during a single load(); a reader slower than that may return a torn
+// value. Use seqlock when that cannot be bounded.
+template<typename T>
+  requires(std::is_trivially_copyable_v<T>)
+class smp_double_buffer {
+public:
+  smp_double_buffer() = default;
+  smp_double_buffer(smp_double_buffer const&) = delete;
+  smp_double_buffer& operator=(smp_double_buffer const&) = delete;
+
+  // Writer-side.
+  void store(T const& value) {
+    std::uint8_t const back = 1 - front_.load(std::memory_order::relaxed);
+    buf_[back].store(value);
+    front_.store(back, std::memory_order::release);
+  }
+
+  // Writer-side. Publishes f(current value).
+  template<typename F>
+  void update(F&& f) {
+    auto const front = front_.load(std::memory_order::relaxed);
+    store(std::forward<F>(f)(buf_[front].load()));
+  }
+
+  T load() const {
+    return buf_[front_.load(std::memory_order::acquire)].load();
+  }
+
+private:
+  detail::atomic_words<T> buf_[2]{};
+  std::atomic<std::uint8_t> front_ = 0;
+};
+
+} // namespace emb
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <emb/concurrent/cache_line.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace emb {
+
+// Lock-free single-producer / single-consumer queue for threads on different
+// cores (host, SMP MCUs). Same interface and concurrency contract as
+// isr_spsc_inplace_queue, laid out for multi-core coherence instead of size:
+//   - the producer's back index and the consumer's front index live on
+//     separate cache lines, so neither side's stores invalidate the line the
+//     other side is writing;
+//   - each side keeps a private copy of the opposite index and refreshes it
+//     (one acquire load, one cache-line transfer) only when the copy says the
+//     queue is full or empty, instead of on every operation.
+// The price is the padding around the two index blocks; on a single-core MCU
+// the compact isr_spsc_inplace_queue is the better fit.
+//
+// Concurrency contract:
+//   - Producer side (one thread only): try_push, try_emplace, reserve,
+//     commit.
+//   - Consumer side (one thread only): try_pop, drain, peek, release, front,
+//     clear.
+//   - Observers (empty, full, size) may be called from either side.
+template<typename T, std::size_t Capacity>
+  requires(std::has_single_bit(Capacity))
+class smp_spsc_inplace_queue {
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = value_type&;
+  using const_reference = value_type const&;
+  using pointer = value_type*;
+  using const_pointer = value_type const*;
+
+private:
+  using atomic_index_type = std::atomic<size_type>;
+  static_assert(atomic_index_type::is_always_lock_free);
+
+  struct no_value_t {};
+  union slot {
+    no_value_t no_value;
+    value_type value;
+    constexpr slot() : no_value{} {}
+    constexpr ~slot()
+      requires std::is_trivially_destructible_v<T>
+    = default;
+    constexpr ~slot()
+      requires(!std::is_trivially_destructible_v<T>) {}
+  };
+
+  // Written by the producer; cached_front is producer-private.
+  struct alignas(cache_line_size) producer_state {
+    atomic_index_type back = 0;
+    size_type cached_front = 0;
+  };
+
+  // Written by the consumer; cached_back is consumer-private.
+  struct alignas(cache_line_size) consumer_state {
+    atomic_index_type front = 0;
+    size_type cached_back = 0;
+  };
+
+  static constexpr size_type capacity_ = Capacity;
+  static constexpr size_type mask_ = Capacity - 1;
+
+  producer_state producer_;
+  consumer_state consumer_;
+  alignas(cache_line_size) std::array<slot, Capacity> data_{};
+
+public:
+  smp_spsc_inplace_queue() = default;
+  smp_spsc_inplace_queue(smp_spsc_inplace_queue const&) = delete;
+  smp_spsc_inplace_queue(smp_spsc_inplace_queue&&) = delete;
+  smp_spsc_inplace_queue& operator=(smp_spsc_inplace_queue const&) = delete;
+  smp_spsc_inplace_queue& operator=(smp_spsc_inplace_queue&&) = delete;
+
+  ~smp_spsc_inplace_queue()
+    requires(std::is_trivially_destructible_v<T>)
+  = default;
+
+  ~smp_spsc_inplace_queue()
+    requires(!std::is_trivially_destructible_v<T>) {
+    clear();
+  }
+
+  // Consumer-side. Destroys all live elements and resets to empty.
+  void clear() {
+    auto const b = producer_.back.load(std::memory_order::acquire);
+    auto f = consumer_.front.load(std::memory_order::relaxed);
+    while (f != b) {
+      destroy_slot(index_of(f));
+      ++f;
+    }
+    consumer_.cached_back = b;
+    consumer_.front.store(b, std::memory_order::release);
+  }
+
+  // Observers. Return an advisory snapshot, as in isr_spsc_inplace_queue.
+  [[nodiscard]] bool empty() const {
+    return size() == 0;
+  }
+
+  [[nodiscard]] bool full() const {
+    return size() == capacity_;
+  }
+
+  [[nodiscard]] size_type capacity() const {
+    return capacity_;
+  }
+
+  [[nodiscard]] size_type size() const {
+    auto const f = consumer_.front.load(std::memory_order::acquire);
+    auto const b = producer_.back.load(std::memory_order::acquire);
+    return b - f;
+  }
+
+  // Producer-side. Returns false if the queue is full.
+  [[nodiscard]] bool try_push(value_type const& value)
+    requires std::is_copy_constructible_v<T> {
+    return try_emplace(value);
+  }
+
+  [[nodiscard]] bool try_push(value_type&& value)
+    requires std::is_move_constructible_v<T> {
+    return try_emplace(std::move(value));
+  }
+
+  template<typename... Args>
+  [[nodiscard]] bool try_emplace(Args&&... args)
+    requires std::is_constructible_v<T, Args...> {
+    auto const b = producer_.back.load(std::memory_order::relaxed);
+    if (free_count(b, 1) == 0) return false;
+    std::construct_at(slot_ptr(index_of(b)), std::forward<Args>(args)...);
+    producer_.back.store(b + 1, std::memory_order::release);
+    return true;
+  }
+
+  // Producer-side, zero-copy. See isr_spsc_inplace_queue::reserve: the
+  // slot(s) at the back, constructed in place and then published by commit.
+  [[nodiscard]] pointer reserve() {
+    auto const b = producer_.back.load(std::memory_order::relaxed);
+    if (free_count(b, 1) == 0) return nullptr;
+    return slot_ptr(index_of(b));
+  }
+
+  [[nodiscard]] std::span<value_type> reserve(size_type max_count) {
+    auto const b = producer_.back.load(std::memory_order::relaxed);
+    auto const b_idx = index_of(b);
+    size_type const count =
+        std::min({max_count, free_count(b, max_count), capacity_ - b_idx});
+    return std::span<value_type>(slot_ptr(b_idx), count);
+  }
+
+  void commit(size_type count = 1) {
+    auto const b = producer_.back.load(std::memory_order::relaxed);
+    producer_.back.store(b + count, std::memory_order::release);
+  }
+
+  // Consumer-side, zero-copy. See isr_spsc_inplace_queue::peek: the head
+  // element(s) in place, destroyed and freed by release.
+  [[nodiscard]] pointer peek() {
+    auto const f = consumer_.front.load(std::memory_order::relaxed);
+    if (ready_count(f, 1) == 0) return nullptr;
+    return slot_ptr(index_of(f));
+  }
+
+  [[nodiscard]] std::span<value_type> peek(size_type max_count) {
+    auto const f = consumer_.front.load(std::memory_order::relaxed);
+    auto const f_idx = index_of(f);
+    size_type const count =
+        std::min({max_count, ready_count(f, max_count), capacity_ - f_idx});
+    return std::span<value_type>(slot_ptr(f_idx), count);
+  }
+
+  void release(size_type count = 1) {
+    auto const f = consumer_.front.load(std::memory_order::relaxed);
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      for (size_type i = 0; i < count; ++i) {
+        destroy_slot(index_of(f + i));
+      }
+    }
+    consumer_.front.store(f + count, std::memory_order::release);
+  }
+
+  // Consumer-side. Non-destructive peek at the head; returns a copy. Reads
+  // the back index directly, leaving the cached copy alone.
+  [[nodiscard]] std::optional<value_type> front() const
+    requires std::is_copy_constructible_v<T> {
+    auto const f = consumer_.front.load(std::memory_order::relaxed);
+    if (f == producer_.back.load(std::memory_order::acquire)) {
+      return std::nullopt;
+    }
+    return std::optional<value_type>(*slot_ptr(index_of(f)));
+  }
+
+  // Consumer-side. Removes and returns the head element, or nullopt if empty.
+  [[nodiscard]] std::optional<value_type> try_pop()
+    requires std::is_move_constructible_v<T> {
+    auto const f = consumer_.front.load(std::memory_order::relaxed);
+    if (ready_count(f, 1) == 0) return std::nullopt;
+    auto const f_idx = index_of(f);
+    std::optional<value_type> result{std::move(*slot_ptr(f_idx))};
+    destroy_slot(f_idx);
+    consumer_.front.store(f + 1, std::memory_order::release);
+    return result;
+  }
+
+  // Consumer-side. See isr_spsc_inplace_queue::drain. Always refreshes the
+  // cached back index, so one call takes everything published so far.
+  template<typename F>
+    requires std::invocable<F&, std::span<value_type const>>
+  size_type drain(F&& consumer, size_type max_count = Capacity) {
+    auto const f = consumer_.front.load(std::memory_order::relaxed);
+    consumer_.cached_back = producer_.back.load(std::memory_order::acquire);
+    size_type const count = std::min(consumer_.cached_back - f, max_count);
+    if (count == 0) return 0;
+
+    auto const f_idx = index_of(f);
+    size_type const head = std::min(count, capacity_ - f_idx);
+    consumer(std::span<value_type const>(slot_ptr(f_idx), head));
+    if (head < count) {
+      consumer(std::span<value_type const>(slot_ptr(0), count - head));
+    }
+
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      for (size_type i = 0; i < count; ++i) {
+        destroy_slot(index_of(f + i));
+      }
+    }
+    consumer_.front.store(f + count, std::memory_order::release);
+    return count;
+  }
+
+private:
+  static constexpr size_type index_of(size_type abs_idx) {
+    return abs_idx & mask_;
+  }
+
+  // Producer-side. Free slots at back index b, refreshing the cached front
+  // index only when it shows fewer than wanted.
+  size_type free_count(size_type b, size_type wanted) {
+    if (capacity_ - (b - producer_.cached_front) < wanted) {
+      producer_.cached_front =
+          consumer_.front.load(std::memory_order::acquire);
+    }
+    return capacity_ - (b - producer_.cached_front);
+  }
+
+  // Consumer-side. Published elements at front index f, refreshing the
+  // cached back index only when it shows fewer than wanted.
+  size_type ready_count(size_type f, size_type wanted) {
+    if (consumer_.cached_back - f < wanted) {
+      consumer_.cached_back = producer_.back.load(std::memory_order::acquire);
+    }
+    return consumer_.cached_back - f;
+  }
+
+  constexpr pointer slot_ptr(size_type i) {
+    return &data_[i].value;
+  }
+
+  constexpr const_pointer slot_ptr(size_type i) const {
+    return &data_[i].value;
+  }
+
+  constexpr void destroy_slot(size_type i) {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      std::destroy_at(slot_ptr(i));
+    }
+  }
+};
+
+} // namespace emb
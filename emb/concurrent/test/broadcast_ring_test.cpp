@@ -0,0 +1,48 @@
+#include <emb/concurrent/broadcast_ring.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace {
+
+template<typename T, std::size_t Capacity>
+concept valid_ring = requires { typename emb::broadcast_ring<T, Capacity>; };
+
+// Power-of-two capacity of trivially copyable samples only.
+static_assert(valid_ring<std::uint16_t, 64>);
+static_assert(!valid_ring<std::uint16_t, 48>);
+static_assert(!valid_ring<std::string, 64>);
+
+using frame = std::array<std::uint16_t, 3>;
+using ring = emb::broadcast_ring<frame, 32>;
+
+// Readers see the samples through a view that loads them from the ring; the
+// spans of the copying read are plain memory owned by the reader.
+static_assert(std::same_as<decltype(std::declval<ring::reader&>().peek()),
+                           ring::view>);
+static_assert(std::same_as<decltype(std::declval<ring::view const&>()[0]),
+                           frame>);
+static_assert(requires(ring::reader& r, std::span<frame> out) {
+  { r.read(out) } -> std::same_as<ring::size_type>;
+  { r.release(ring::size_type{}) } -> std::same_as<bool>;
+  { r.lost() } -> std::same_as<ring::index_type>;
+});
+static_assert(requires(ring& rg, frame const& f, std::span<frame const> fs) {
+  rg.push(f);
+  rg.push(fs);
+  { rg.subscribe() } -> std::same_as<ring::reader>;
+});
+
+// Word-wise atomic storage keeps small samples dense: a 6-byte frame is
+// three 16-bit words, not a padded native word per sample.
+static_assert(sizeof(emb::detail::atomic_words<frame>) == sizeof(frame));
+static_assert(sizeof(emb::detail::atomic_words<std::uint16_t>) == 2);
+static_assert(sizeof(ring) < 32 * sizeof(frame) + 64);
+
+static_assert(!std::copy_constructible<ring>);
+
+} // namespace
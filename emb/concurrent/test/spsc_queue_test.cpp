@@ -0,0 +1,46 @@
+#include <emb/concurrent/isr_spsc_inplace_queue.hpp>
+#include <emb/concurrent/smp_spsc_inplace_queue.hpp>
+#include <emb/sensor/concepts.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace {
+
+// Both SPSC queues offer the same interface, so either can back a buffered
+// sensor and take the bulk (drain) path.
+template<typename Q>
+concept full_spsc_interface = requires(
+    Q q,
+    Q const cq,
+    typename Q::value_type v,
+    std::size_t n
+) {
+  { q.try_push(v) } -> std::same_as<bool>;
+  { q.try_emplace(v) } -> std::same_as<bool>;
+  { q.reserve() } -> std::same_as<typename Q::pointer>;
+  { q.reserve(n) } -> std::same_as<std::span<typename Q::value_type>>;
+  q.commit(n);
+  { q.try_pop() } -> std::same_as<std::optional<typename Q::value_type>>;
+  { q.peek() } -> std::same_as<typename Q::pointer>;
+  { q.peek(n) } -> std::same_as<std::span<typename Q::value_type>>;
+  q.release(n);
+  { cq.front() } -> std::same_as<std::optional<typename Q::value_type>>;
+  q.clear();
+  { cq.empty() } -> std::same_as<bool>;
+  { cq.full() } -> std::same_as<bool>;
+  { cq.size() } -> std::same_as<std::size_t>;
+};
+
+using isr_queue = emb::isr_spsc_inplace_queue<std::uint16_t, 64>;
+using smp_queue = emb::smp_spsc_inplace_queue<std::uint16_t, 64>;
+
+static_assert(full_spsc_interface<isr_queue>);
+static_assert(full_spsc_interface<smp_queue>);
+static_assert(emb::sensor::some_bulk_spsc_queue<isr_queue>);
+static_assert(emb::sensor::some_bulk_spsc_queue<smp_queue>);
+
+} // namespace
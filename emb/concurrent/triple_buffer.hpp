@@ -10,24 +10,67 @@ namespace emb {
 // No constraint on writer commit rate — the reader always gets
 // the latest committed value without torn reads.
 // Requires hardware atomics (LDREX/STREX on Cortex-M).
+//
+// Besides the copying store()/load(), both sides can work on the buffers in
+// place, which avoids two full copies per cycle for large frames:
+//   writer: T& f = acquire_write(); ...fill f...; publish();
+//   reader: if (updated()) { T const& f = acquire_read(); ...inspect f... }
+// The reference from acquire_write() stays valid until publish(), the one
+// from acquire_read() until the next acquire_read()/load(); the other side
+// never touches those buffers meanwhile. A buffer handed out by
+// acquire_write() holds an older frame, not the last published one, so the
+// writer must overwrite every field it publishes.
 template <typename T>
   requires(std::is_trivially_copyable_v<T>)
 class triple_buffer {
 public:
+  // Writer-side.
   void store(T const& value) {
-    buf_[write_] = value;
+    acquire_write() = value;
+    publish();
+  }
+
+  // Writer-side. The back buffer, owned by the writer until publish().
+  T& acquire_write() {
+    return buf_[write_];
+  }
+
+  // Writer-side. Makes the back buffer the latest frame and takes over the
+  // previously shared one.
+  void publish() {
     std::atomic_signal_fence(std::memory_order_release);
-    write_ = shared_.exchange(write_, std::memory_order_relaxed);
+    write_ = shared_.exchange(write_ | fresh_bit, std::memory_order_relaxed) &
+             index_mask;
   }
 
-  T load() const {
-    read_ = shared_.exchange(read_, std::memory_order_relaxed);
-    std::atomic_signal_fence(std::memory_order_acquire);
+  // Reader-side. True if a frame was published since the last
+  // acquire_read()/load().
+  bool updated() const {
+    return (shared_.load(std::memory_order_relaxed) & fresh_bit) != 0;
+  }
+
+  // Reader-side. Latest published frame, in place. Without a new
+  // publication the reader keeps its current frame, so it never goes back to
+  // an older one.
+  T const& acquire_read() const {
+    if (updated()) {
+      read_ = shared_.exchange(read_, std::memory_order_relaxed) & index_mask;
+      std::atomic_signal_fence(std::memory_order_acquire);
+    }
     return buf_[read_];
   }
 
+  T load() const {
+    return acquire_read();
+  }
+
 private:
+  static constexpr std::uint8_t index_mask = 0x03;
+  static constexpr std::uint8_t fresh_bit = 0x04;
+
   T buf_[3]{};
+  // Index of the shared buffer, plus fresh_bit while it holds a frame the
+  // reader has not taken yet.
   std::atomic<std::uint8_t> mutable shared_{0};
   std::uint8_t write_ = 1;
   std::uint8_t mutable read_ = 2;
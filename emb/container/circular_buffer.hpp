@@ -1,10 +1,14 @@
 #pragma once
 
 #include <emb/assert.hpp>
+#include <emb/container/detail/slot_copy.hpp>
 
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <memory>
 #include <optional>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -232,7 +236,7 @@ public:
   constexpr void pop_front() {
     ASSUME(size_ != 0);
     destroy_slot(front_);
-    front_ = (front_ + 1) % capacity_;
+    front_ = wrap(front_ + 1);
     --size_;
   }
 
@@ -258,6 +262,66 @@ public:
     return result;
   }
 
+  // Same result as push_back of every value in order: the oldest elements are
+  // overwritten once the buffer is full, and at most the last capacity()
+  // values survive.
+  constexpr void push_back(std::span<value_type const> values)
+    requires std::is_copy_constructible_v<T> {
+    if (values.size() > capacity_) {
+      values = values.last(capacity_);
+    }
+    size_type const count = values.size();
+    size_type const overflow =
+        size_ + count > capacity_ ? size_ + count - capacity_ : 0;
+    for (size_type i = 0; i < overflow; ++i) {
+      destroy_slot(index_of(i));
+    }
+    front_ = wrap(front_ + overflow);
+    size_ -= overflow;
+
+    size_type const back = index_of(size_);
+    size_type const head = std::min(count, capacity_ - back);
+    detail::construct_slots(slot_fn(), back, values.first(head));
+    detail::construct_slots(slot_fn(), 0, values.subspan(head));
+    size_ += count;
+  }
+
+  // Moves up to out.size() elements from the front into out and removes
+  // them. Returns the number of elements moved.
+  constexpr size_type pop_front(std::span<value_type> out)
+    requires std::is_move_assignable_v<T> {
+    size_type const count = std::min(out.size(), size_);
+    size_type const head = std::min(count, capacity_ - front_);
+    detail::move_from_slots(slot_fn(), front_, out.first(head));
+    detail::move_from_slots(slot_fn(), 0, out.subspan(head, count - head));
+    for (size_type i = 0; i < count; ++i) {
+      destroy_slot(index_of(i));
+    }
+    front_ = wrap(front_ + count);
+    size_ -= count;
+    return count;
+  }
+
+  // The contents in order as two contiguous runs: front to the end of the
+  // storage, then -- non-empty only when the contents wrap -- the start of
+  // the storage. Valid until the buffer is next modified.
+  [[nodiscard]] constexpr std::array<std::span<value_type>, 2> as_spans() {
+    size_type const head = std::min(size_, capacity_ - front_);
+    return {
+        std::span<value_type>(slot_ptr(front_), head),
+        std::span<value_type>(slot_ptr(0), size_ - head)
+    };
+  }
+
+  [[nodiscard]] constexpr std::array<std::span<value_type const>, 2>
+  as_spans() const {
+    size_type const head = std::min(size_, capacity_ - front_);
+    return {
+        std::span<value_type const>(slot_ptr(front_), head),
+        std::span<value_type const>(slot_ptr(0), size_ - head)
+    };
+  }
+
   constexpr void fill(value_type const& value)
     requires std::is_copy_constructible_v<T> {
     clear();
@@ -268,8 +332,21 @@ public:
   }
 
 private:
+  // Power-of-two capacities wrap with a mask instead of a division.
+  static constexpr size_type wrap(size_type i) {
+    if constexpr (std::has_single_bit(Capacity)) {
+      return i & (capacity_ - 1);
+    } else {
+      return i % capacity_;
+    }
+  }
+
   constexpr size_type index_of(size_type offset) const {
-    return (front_ + offset) % capacity_;
+    return wrap(front_ + offset);
+  }
+
+  constexpr auto slot_fn() {
+    return [this](size_type i) { return slot_ptr(i); };
   }
 
   constexpr pointer slot_ptr(size_type i) {
@@ -292,7 +369,7 @@ private:
     if (full()) {
       destroy_slot(slot_idx);
       construct_fn(slot_ptr(slot_idx));
-      front_ = (front_ + 1) % capacity_;
+      front_ = wrap(front_ + 1);
     } else {
       construct_fn(slot_ptr(slot_idx));
       ++size_;
@@ -301,7 +378,7 @@ private:
 
   template<typename F>
   constexpr void write_front_with(F&& construct_fn) {
-    size_type const new_front = (front_ + capacity_ - 1) % capacity_;
+    size_type const new_front = wrap(front_ + capacity_ - 1);
     if (full()) {
       destroy_slot(new_front);
       construct_fn(slot_ptr(new_front));
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace emb::detail {
+
+// Bulk transfers between a span and a run of union slots. slot(i) yields the
+// value pointer of storage slot i. Outside constant evaluation a trivially
+// copyable T moves as one memcpy over the run, which the slot layout keeps
+// contiguous; otherwise -- and always during constant evaluation, where the
+// slots are distinct objects -- element by element.
+
+// Copy-constructs src into the uninitialized slots [first, first + size).
+template<typename T, typename SlotPtr>
+constexpr void
+construct_slots(SlotPtr slot, std::size_t first, std::span<T const> src) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if !consteval {
+      if (!src.empty()) {
+        std::memcpy(slot(first), src.data(), src.size_bytes());
+      }
+      return;
+    }
+  }
+  for (std::size_t i = 0; i < src.size(); ++i) {
+    std::construct_at(slot(first + i), src[i]);
+  }
+}
+
+// Move-assigns the live slots [first, first + size) into dst; the slots stay
+// alive (moved-from) for the caller to destroy.
+template<typename T, typename SlotPtr>
+constexpr void
+move_from_slots(SlotPtr slot, std::size_t first, std::span<T> dst) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if !consteval {
+      if (!dst.empty()) {
+        std::memcpy(dst.data(), slot(first), dst.size_bytes());
+      }
+      return;
+    }
+  }
+  for (std::size_t i = 0; i < dst.size(); ++i) {
+    dst[i] = std::move(*slot(first + i));
+  }
+}
+
+} // namespace emb::detail
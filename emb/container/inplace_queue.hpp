@@ -1,10 +1,14 @@
 #pragma once
 
 #include <emb/assert.hpp>
+#include <emb/container/detail/slot_copy.hpp>
 
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <memory>
 #include <optional>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -190,7 +194,7 @@ public:
   constexpr void pop() {
     ASSUME(size_ != 0);
     destroy_slot(front_);
-    front_ = (front_ + 1) % capacity_;
+    front_ = wrap(front_ + 1);
     --size_;
   }
 
@@ -202,9 +206,70 @@ public:
     return result;
   }
 
+  // Pushes every value in order; values.size() must not exceed the free
+  // space.
+  constexpr void push(std::span<value_type const> values)
+    requires std::is_copy_constructible_v<T> {
+    ASSUME(values.size() <= capacity_ - size_);
+    size_type const back = index_of(size_);
+    size_type const head = std::min(values.size(), capacity_ - back);
+    detail::construct_slots(slot_fn(), back, values.first(head));
+    detail::construct_slots(slot_fn(), 0, values.subspan(head));
+    size_ += values.size();
+  }
+
+  // Moves up to out.size() elements from the front into out and removes
+  // them. Returns the number of elements moved.
+  constexpr size_type pop(std::span<value_type> out)
+    requires std::is_move_assignable_v<T> {
+    size_type const count = std::min(out.size(), size_);
+    size_type const head = std::min(count, capacity_ - front_);
+    detail::move_from_slots(slot_fn(), front_, out.first(head));
+    detail::move_from_slots(slot_fn(), 0, out.subspan(head, count - head));
+    for (size_type i = 0; i < count; ++i) {
+      destroy_slot(index_of(i));
+    }
+    front_ = wrap(front_ + count);
+    size_ -= count;
+    return count;
+  }
+
+  // The queued elements front to back as two contiguous runs; the second is
+  // non-empty only when the contents wrap around the end of the storage.
+  // Valid until the queue is next modified.
+  [[nodiscard]] constexpr std::array<std::span<value_type>, 2> as_spans() {
+    size_type const head = std::min(size_, capacity_ - front_);
+    return {
+        std::span<value_type>(slot_ptr(front_), head),
+        std::span<value_type>(slot_ptr(0), size_ - head)
+    };
+  }
+
+  [[nodiscard]] constexpr std::array<std::span<value_type const>, 2>
+  as_spans() const {
+    size_type const head = std::min(size_, capacity_ - front_);
+    return {
+        std::span<value_type const>(slot_ptr(front_), head),
+        std::span<value_type const>(slot_ptr(0), size_ - head)
+    };
+  }
+
 private:
+  // Power-of-two capacities wrap with a mask instead of a division.
+  static constexpr size_type wrap(size_type i) {
+    if constexpr (std::has_single_bit(Capacity)) {
+      return i & (capacity_ - 1);
+    } else {
+      return i % capacity_;
+    }
+  }
+
   constexpr size_type index_of(size_type offset) const {
-    return (front_ + offset) % capacity_;
+    return wrap(front_ + offset);
+  }
+
+  constexpr auto slot_fn() {
+    return [this](size_type i) { return slot_ptr(i); };
   }
 
   constexpr pointer slot_ptr(size_type i) {
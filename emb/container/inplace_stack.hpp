@@ -1,10 +1,13 @@
 #pragma once
 
 #include <emb/assert.hpp>
+#include <emb/container/detail/slot_copy.hpp>
 
+#include <algorithm>
 #include <array>
 #include <memory>
 #include <optional>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -189,7 +192,44 @@ public:
     return result;
   }
 
+  // Pushes every value in order, so values.back() ends up on top;
+  // values.size() must not exceed the free space.
+  constexpr void push(std::span<value_type const> values)
+    requires std::is_copy_constructible_v<T> {
+    ASSUME(values.size() <= capacity_ - size_);
+    detail::construct_slots(slot_fn(), size_, values);
+    size_ += values.size();
+  }
+
+  // Moves the top min(out.size(), size()) elements into out, bottom-most
+  // first (out.front() receives the deepest of them, the last written the
+  // old top), and removes them. Returns the number of elements moved.
+  constexpr size_type pop(std::span<value_type> out)
+    requires std::is_move_assignable_v<T> {
+    size_type const count = std::min(out.size(), size_);
+    size_type const first = size_ - count;
+    detail::move_from_slots(slot_fn(), first, out.first(count));
+    for (size_type i = size_; i > first; --i) {
+      destroy_slot(i - 1);
+    }
+    size_ = first;
+    return count;
+  }
+
+  // The elements bottom to top. Valid until the stack is next modified.
+  [[nodiscard]] constexpr std::span<value_type> as_span() {
+    return std::span<value_type>(slot_ptr(0), size_);
+  }
+
+  [[nodiscard]] constexpr std::span<value_type const> as_span() const {
+    return std::span<value_type const>(slot_ptr(0), size_);
+  }
+
 private:
+  constexpr auto slot_fn() {
+    return [this](size_type i) { return slot_ptr(i); };
+  }
+
   constexpr pointer slot_ptr(size_type i) {
     return &data_[i].value;
   }
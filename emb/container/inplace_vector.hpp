@@ -1,10 +1,14 @@
 #pragma once
 
 #include <emb/assert.hpp>
+#include <emb/container/detail/slot_copy.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 #include <memory>
 #include <optional>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -243,7 +247,72 @@ public:
     return result;
   }
 
+  // Appends every value in order; values.size() must not exceed the free
+  // space.
+  constexpr void push_back(std::span<value_type const> values)
+    requires std::is_copy_constructible_v<T> {
+    ASSUME(values.size() <= capacity_ - size_);
+    detail::construct_slots(slot_fn(), size_, values);
+    size_ += values.size();
+  }
+
+  // Inserts values before position pos, shifting the tail up. values must not
+  // alias the vector and must fit in the free space.
+  constexpr void insert(size_type pos, std::span<value_type const> values)
+    requires std::is_copy_constructible_v<T>
+          && std::is_move_constructible_v<T> {
+    ASSUME(pos <= size_);
+    ASSUME(values.size() <= capacity_ - size_);
+    size_type const count = values.size();
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      if !consteval {
+        if (count != 0 && pos != size_) {
+          std::memmove(
+              slot_ptr(pos + count),
+              slot_ptr(pos),
+              (size_ - pos) * sizeof(T)
+          );
+        }
+        detail::construct_slots(slot_fn(), pos, values);
+        size_ += count;
+        return;
+      }
+    }
+    for (size_type i = size_; i > pos; --i) {
+      std::construct_at(slot_ptr(i - 1 + count), std::move(*slot_ptr(i - 1)));
+      destroy_slot(i - 1);
+    }
+    detail::construct_slots(slot_fn(), pos, values);
+    size_ += count;
+  }
+
+  // Moves the last min(out.size(), size()) elements into out in order and
+  // removes them. Returns the number of elements moved.
+  constexpr size_type pop_back(std::span<value_type> out)
+    requires std::is_move_assignable_v<T> {
+    size_type const count = std::min(out.size(), size_);
+    size_type const first = size_ - count;
+    detail::move_from_slots(slot_fn(), first, out.first(count));
+    for (size_type i = size_; i > first; --i) {
+      destroy_slot(i - 1);
+    }
+    size_ = first;
+    return count;
+  }
+
+  [[nodiscard]] constexpr std::span<value_type> as_span() {
+    return std::span<value_type>(slot_ptr(0), size_);
+  }
+
+  [[nodiscard]] constexpr std::span<value_type const> as_span() const {
+    return std::span<value_type const>(slot_ptr(0), size_);
+  }
+
 private:
+  constexpr auto slot_fn() {
+    return [this](size_type i) { return slot_ptr(i); };
+  }
+
   constexpr pointer slot_ptr(size_type i) {
     return &data_[i].value;
   }
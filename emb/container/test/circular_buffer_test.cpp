@@ -1,5 +1,8 @@
 #include <emb/container/circular_buffer.hpp>
 
+#include <array>
+#include <span>
+
 namespace {
 
 template<typename CircularBuffer>
@@ -115,4 +118,46 @@ static_assert(test_circular_buffer(emb::circular_buffer<int, 2>{}));
 static_assert(test_circular_buffer(emb::circular_buffer<int, 5>{}));
 static_assert(test_circular_buffer(emb::circular_buffer<int, 10>{}));
 
+// Range push/pop agree with the element-wise operations, including across
+// the wrap and past capacity; as_spans splits the contents at the wrap.
+template<std::size_t Capacity>
+constexpr bool test_circular_buffer_ranges() {
+  emb::circular_buffer<int, Capacity> ranged;
+  emb::circular_buffer<int, Capacity> single;
+  std::array<int, 2 * Capacity + 1> input{};
+  for (auto i = 0uz; i < input.size(); ++i) {
+    input[i] = static_cast<int>(i) + 1;
+  }
+
+  for (auto n : {1uz, Capacity - 1, Capacity + 2, 2uz}) {
+    std::span<int const> const chunk(input.data(), n);
+    ranged.push_back(chunk);
+    for (int v : chunk) {
+      single.push_back(v);
+    }
+    assert(ranged.size() == single.size());
+    for (auto i = 0uz; i < single.size(); ++i) {
+      assert(ranged[i] == single[i]);
+    }
+
+    auto const [head, tail] = ranged.as_spans();
+    assert(head.size() + tail.size() == ranged.size());
+    assert(head.front() == ranged.front());
+    if (!tail.empty()) {
+      assert(tail.front() == ranged[head.size()]);
+    }
+  }
+
+  std::array<int, Capacity + 1> out{};
+  auto const popped = ranged.pop_front(out);
+  assert(popped == single.size() && ranged.empty());
+  for (auto i = 0uz; i < popped; ++i) {
+    assert(out[i] == single[i]);
+  }
+  return true;
+}
+
+static_assert(test_circular_buffer_ranges<4>());
+static_assert(test_circular_buffer_ranges<5>());
+
 } // namespace
@@ -1,5 +1,8 @@
 #include <emb/container/inplace_queue.hpp>
 
+#include <array>
+#include <span>
+
 namespace {
 
 template<typename Queue>
@@ -298,4 +301,50 @@ static_assert(test_inplace_queue_no_default_ctor());
 static_assert(test_inplace_queue_move());
 static_assert(test_inplace_queue_move_wraparound());
 
+constexpr bool test_inplace_queue_ranges() {
+  emb::inplace_queue<int, 8> q;
+  std::array<int, 8> const input{1, 2, 3, 4, 5, 6, 7, 8};
+  std::array<int, 8> out{};
+
+  q.push(std::span<int const>(input).first(6));
+  assert(q.pop(std::span<int>(out).first(4)) == 4);
+  assert(out[0] == 1 && out[3] == 4);
+
+  // Wraps: slots 6, 7, then 0..3.
+  q.push(std::span<int const>(input).first(6));
+  assert(q.size() == 8 && q.full());
+  auto const [head, tail] = q.as_spans();
+  assert(head.size() == 4 && tail.size() == 4);
+  assert(head.front() == 5 && tail.front() == 3);
+
+  assert(q.pop(out) == 8 && q.empty());
+  std::array<int, 8> const expected{5, 6, 1, 2, 3, 4, 5, 6};
+  assert(out == expected);
+  assert(q.pop(out) == 0);
+  return true;
+}
+
+constexpr bool test_inplace_queue_ranges_lifetime() {
+  int alive = 0;
+  std::array<tracked, 3> const input{
+      tracked(1, &alive),
+      tracked(2, &alive),
+      tracked(3, &alive)
+  };
+  {
+    emb::inplace_queue<tracked, 4> q;
+    q.push(input);
+    assert(alive == 6);
+    std::array<tracked, 2> out{};
+    assert(q.pop(out) == 2);
+    assert(out[0].value == 1 && out[1].value == 2);
+    assert(q.size() == 1 && q.front().value == 3);
+  }
+  assert(alive == 3);
+  return true;
+}
+
+static_assert(test_inplace_queue_ranges());
+static_assert(test_inplace_queue_ranges_lifetime());
+
 } // namespace
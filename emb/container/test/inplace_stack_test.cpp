@@ -1,5 +1,7 @@
 #include <emb/container/inplace_stack.hpp>
 
+#include <array>
+
 namespace {
 
 template<typename Stack>
@@ -243,4 +245,23 @@ static_assert(test_inplace_stack_try_pop());
 static_assert(test_inplace_stack_try_push());
 static_assert(test_inplace_stack_no_default_ctor());
 
+constexpr bool test_inplace_stack_ranges() {
+  emb::inplace_stack<int, 6> s;
+  std::array<int, 4> const input{1, 2, 3, 4};
+
+  s.push(input);
+  assert(s.size() == 4 && s.top() == 4);
+  assert(s.as_span().size() == 4 && s.as_span().front() == 1);
+
+  std::array<int, 3> out{};
+  assert(s.pop(out) == 3);
+  assert(out[0] == 2 && out[1] == 3 && out[2] == 4);
+  assert(s.size() == 1 && s.top() == 1);
+
+  assert(s.pop(out) == 1 && out[0] == 1 && s.empty());
+  return true;
+}
+
+static_assert(test_inplace_stack_ranges());
+
 } // namespace
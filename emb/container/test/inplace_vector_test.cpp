@@ -1,5 +1,8 @@
 #include <emb/container/inplace_vector.hpp>
 
+#include <array>
+#include <span>
+
 namespace {
 
 template<typename Vector>
@@ -255,4 +258,44 @@ static_assert(test_inplace_vector_try_pop());
 static_assert(test_inplace_vector_try_push());
 static_assert(test_inplace_vector_no_default_ctor());
 
+constexpr bool test_inplace_vector_ranges() {
+  emb::inplace_vector<int, 8> v;
+  std::array<int, 3> const head{1, 2, 3};
+  std::array<int, 2> const mid{10, 20};
+
+  v.push_back(head);
+  v.insert(1, mid);
+  v.insert(v.size(), std::span<int const>(head).first(1));
+  std::array<int, 6> const expected{1, 10, 20, 2, 3, 1};
+  assert(v.size() == expected.size());
+  for (auto i = 0uz; i < expected.size(); ++i) {
+    assert(v[i] == expected[i]);
+  }
+  assert(v.as_span().size() == 6 && v.as_span().front() == 1);
+
+  std::array<int, 2> out{};
+  assert(v.pop_back(out) == 2);
+  assert(out[0] == 3 && out[1] == 1 && v.size() == 4);
+  return true;
+}
+
+constexpr bool test_inplace_vector_insert_lifetime() {
+  int alive = 0;
+  std::array<tracked, 2> const input{tracked(7, &alive), tracked(8, &alive)};
+  {
+    emb::inplace_vector<tracked, 5> v;
+    v.emplace_back(1, &alive);
+    v.emplace_back(2, &alive);
+    v.insert(1, input);
+    assert(alive == 6);
+    assert(v[0].value == 1 && v[1].value == 7);
+    assert(v[2].value == 8 && v[3].value == 2);
+  }
+  assert(alive == 2);
+  return true;
+}
+
+static_assert(test_inplace_vector_ranges());
+static_assert(test_inplace_vector_insert_lifetime());
+
 } // namespace
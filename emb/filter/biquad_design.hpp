@@ -0,0 +1,176 @@
+#pragma once
+
+#include <emb/math.hpp>
+#include <emb/units.hpp>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <numbers>
+
+namespace emb {
+
+// Coefficients of one second-order section, normalized to a0 = 1:
+//   H(z) = (b0 + b1*z^-1 + b2*z^-2) / (1 + a1*z^-1 + a2*z^-2)
+struct biquad_coefficients {
+  float b0;
+  float b1;
+  float b2;
+  float a1;
+  float a2;
+
+  // Gain at DC (z = 1).
+  constexpr float dc_gain() const {
+    return (b0 + b1 + b2) / (1.0f + a1 + a2);
+  }
+};
+
+// Bilinear-transform designers after the RBJ audio-EQ cookbook. All of them
+// are constexpr: evaluate them into a constexpr/constinit object and the
+// coefficients are computed at compile time, with no trigonometry at startup.
+
+namespace detail {
+
+struct biquad_prewarped {
+  float cos_w0;
+  float alpha;
+};
+
+constexpr biquad_prewarped
+biquad_prewarp(units::hz_f32 f0, units::sec_f32 sample_period, float q) {
+  assert(f0.value() > 0.0f);
+  assert(q > 0.0f);
+  assert(2.0f * f0.value() * sample_period.value() < 1.0f);
+  float const w0 = 2 * std::numbers::pi_v<float> * f0.value()
+                 * sample_period.value();
+  return {.cos_w0 = emb::cos(w0), .alpha = emb::sin(w0) / (2.0f * q)};
+}
+
+constexpr biquad_coefficients biquad_normalize(
+    float b0,
+    float b1,
+    float b2,
+    float a0,
+    float a1,
+    float a2
+) {
+  return {
+      .b0 = b0 / a0,
+      .b1 = b1 / a0,
+      .b2 = b2 / a0,
+      .a1 = a1 / a0,
+      .a2 = a2 / a0
+  };
+}
+
+// Quality factor of pole pair k of an order-N Butterworth prototype.
+constexpr float butterworth_q(std::size_t k, std::size_t order) {
+  float const theta = std::numbers::pi_v<float>
+                    * static_cast<float>(2 * k + order + 1)
+                    / static_cast<float>(2 * order);
+  return -1.0f / (2.0f * emb::cos(theta));
+}
+
+} // namespace detail
+
+constexpr biquad_coefficients lowpass_biquad(
+    units::hz_f32 cutoff,
+    units::sec_f32 sample_period,
+    float q = std::numbers::sqrt2_v<float> / 2
+) {
+  auto const [c, alpha] = detail::biquad_prewarp(cutoff, sample_period, q);
+  return detail::biquad_normalize(
+      (1.0f - c) / 2.0f,
+      1.0f - c,
+      (1.0f - c) / 2.0f,
+      1.0f + alpha,
+      -2.0f * c,
+      1.0f - alpha
+  );
+}
+
+constexpr biquad_coefficients highpass_biquad(
+    units::hz_f32 cutoff,
+    units::sec_f32 sample_period,
+    float q = std::numbers::sqrt2_v<float> / 2
+) {
+  auto const [c, alpha] = detail::biquad_prewarp(cutoff, sample_period, q);
+  return detail::biquad_normalize(
+      (1.0f + c) / 2.0f,
+      -(1.0f + c),
+      (1.0f + c) / 2.0f,
+      1.0f + alpha,
+      -2.0f * c,
+      1.0f - alpha
+  );
+}
+
+// Band-pass with 0 dB gain at the center frequency; bandwidth = center / q.
+constexpr biquad_coefficients bandpass_biquad(
+    units::hz_f32 center,
+    units::sec_f32 sample_period,
+    float q
+) {
+  auto const [c, alpha] = detail::biquad_prewarp(center, sample_period, q);
+  return detail::biquad_normalize(
+      alpha,
+      0.0f,
+      -alpha,
+      1.0f + alpha,
+      -2.0f * c,
+      1.0f - alpha
+  );
+}
+
+// Notch with unity gain away from the center frequency; the -3 dB stop band
+// is center / q wide.
+constexpr biquad_coefficients notch_biquad(
+    units::hz_f32 center,
+    units::sec_f32 sample_period,
+    float q
+) {
+  auto const [c, alpha] = detail::biquad_prewarp(center, sample_period, q);
+  return detail::biquad_normalize(
+      1.0f,
+      -2.0f * c,
+      1.0f,
+      1.0f + alpha,
+      -2.0f * c,
+      1.0f - alpha
+  );
+}
+
+// Butterworth low-pass of order 2 * Sections as a cascade of biquads, one per
+// pole pair.
+template<std::size_t Sections>
+  requires(Sections > 0)
+constexpr std::array<biquad_coefficients, Sections>
+butterworth_lowpass(units::hz_f32 cutoff, units::sec_f32 sample_period) {
+  std::array<biquad_coefficients, Sections> sos{};
+  for (std::size_t k = 0; k < Sections; ++k) {
+    sos[k] = lowpass_biquad(
+        cutoff,
+        sample_period,
+        detail::butterworth_q(k, 2 * Sections)
+    );
+  }
+  return sos;
+}
+
+// Butterworth high-pass of order 2 * Sections.
+template<std::size_t Sections>
+  requires(Sections > 0)
+constexpr std::array<biquad_coefficients, Sections>
+butterworth_highpass(units::hz_f32 cutoff, units::sec_f32 sample_period) {
+  std::array<biquad_coefficients, Sections> sos{};
+  for (std::size_t k = 0; k < Sections; ++k) {
+    sos[k] = highpass_biquad(
+        cutoff,
+        sample_period,
+        detail::butterworth_q(k, 2 * Sections)
+    );
+  }
+  return sos;
+}
+
+} // namespace emb
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <emb/algorithm.hpp>
+#include <emb/filter/detail/sorted_window.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace emb {
+
+namespace detail {
+
+// Sliding window for the small deployed sizes (see has_median_network): the
+// samples sit in a plain ring and the median is re-evaluated by a branchless
+// sorting network on every read. The median does not depend on sample order,
+// so the ring is never unrolled. T may be a std::array of lanes, in which case
+// the window yields per-lane medians.
+template<typename T, std::size_t WindowSize>
+  requires emb::has_median_network<WindowSize>
+class network_window {
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  static constexpr size_type window_size = WindowSize;
+private:
+  std::array<value_type, window_size> data_{};
+  size_type next_ = 0;
+public:
+  constexpr explicit network_window(value_type const& init = value_type()) {
+    fill(init);
+  }
+
+  constexpr void fill(value_type const& value) {
+    data_.fill(value);
+    next_ = 0;
+  }
+
+  constexpr void push(value_type const& value) {
+    data_[next_] = value;
+    if (++next_ == window_size) {
+      next_ = 0;
+    }
+  }
+
+  constexpr value_type median() const {
+    return emb::median_network(data_);
+  }
+};
+
+// Compile-time choice of the median window: sorting network for the small
+// sizes, incrementally sorted window otherwise.
+template<
+    typename T,
+    std::size_t WindowSize,
+    bool = emb::has_median_network<WindowSize>>
+struct median_window_selector {
+  using type = sorted_window<T, WindowSize>;
+};
+
+template<typename T, std::size_t WindowSize>
+struct median_window_selector<T, WindowSize, true> {
+  using type = network_window<T, WindowSize>;
+};
+
+template<typename T, std::size_t WindowSize>
+using median_window = typename median_window_selector<T, WindowSize>::type;
+
+} // namespace detail
+
+} // namespace emb
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <algorithm>
+
+namespace emb {
+
+namespace detail {
+
+// Smoothing factor of a first-order low-pass step, sampling_period /
+// time_constant clamped to [0, 1]. Shared by the exponential filters so they
+// all derive it the same way.
+template<typename Duration>
+constexpr auto
+smooth_factor(Duration sampling_period, Duration time_constant) {
+  using factor_type = decltype(sampling_period / time_constant);
+  return std::clamp(
+      sampling_period / time_constant,
+      factor_type(0),
+      factor_type(1)
+  );
+}
+
+} // namespace detail
+
+} // namespace emb
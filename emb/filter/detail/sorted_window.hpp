@@ -0,0 +1,78 @@
+#pragma once
+
+#include <emb/algorithm.hpp>
+#include <emb/container/circular_buffer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+namespace emb {
+
+namespace detail {
+
+// Sliding window that keeps its samples both in arrival order (to know which
+// one leaves next) and in sorted order (to read order statistics in O(1)).
+// The window is always full: construction and fill() seed every slot, so a
+// push always evicts exactly one sample. A push locates the evicted sample and
+// the insertion point by binary search and shifts the elements in between by
+// one slot -- O(log N) compares plus one memmove for trivially copyable T,
+// instead of a full copy-and-sort. Lane arrays are not supported: their
+// operator< is lexicographic, not per lane.
+template<typename T, std::size_t WindowSize>
+  requires(WindowSize > 0 && !is_lane_array<T>::value)
+class sorted_window {
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using const_reference = value_type const&;
+  static constexpr size_type window_size = WindowSize;
+private:
+  emb::circular_buffer<value_type, window_size> history_;
+  std::array<value_type, window_size> sorted_{};
+public:
+  constexpr explicit sorted_window(value_type const& init = value_type()) {
+    fill(init);
+  }
+
+  constexpr void fill(value_type const& value) {
+    history_.fill(value);
+    sorted_.fill(value);
+  }
+
+  constexpr void push(value_type const& value) {
+    value_type const evicted = history_.front();
+    history_.push_back(value);
+
+    auto const first = sorted_.begin();
+    auto const last = sorted_.end();
+    auto const pos = std::lower_bound(first, last, evicted);
+
+    if (evicted < value) {
+      // shift (pos, dst) one slot left, insert before the first >= value
+      auto const dst = std::lower_bound(pos + 1, last, value);
+      std::move(pos + 1, dst, pos);
+      *(dst - 1) = value;
+    } else if (value < evicted) {
+      // shift [dst, pos) one slot right, insert at the first > value
+      auto const dst = std::upper_bound(first, pos, value);
+      std::move_backward(dst, pos, pos + 1);
+      *dst = value;
+    } else {
+      *pos = value;
+    }
+  }
+
+  constexpr const_reference median() const
+    requires(window_size % 2 == 1) {
+    return sorted_[window_size / 2];
+  }
+
+  constexpr std::array<value_type, window_size> const& sorted() const {
+    return sorted_;
+  }
+};
+
+} // namespace detail
+
+} // namespace emb
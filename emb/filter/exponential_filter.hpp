@@ -1,6 +1,11 @@
 #pragma once
 
-#include <algorithm>
+#include <emb/assert.hpp>
+#include <emb/filter/detail/smooth_factor.hpp>
+
+#include <array>
+#include <cstddef>
+#include <span>
 #include <utility>
 
 namespace emb {
@@ -35,6 +40,39 @@ public:
     output_ = output_ + smooth_factor_ * (input_v - output_);
   }
 
+  // Block push. The recurrence y' = b*y + a*x (b = 1 - a) is unrolled by
+  // four: y4 = b^4*y + a*(b^3*x0 + b^2*x1 + b*x2 + x3). The input-only term
+  // has no dependency on y, so the serial chain is one multiply-add per four
+  // samples instead of one per sample.
+  constexpr void push(std::span<value_type const> input) {
+    factor_type const a = smooth_factor_;
+    factor_type const b = factor_type(1) - a;
+    factor_type const b2 = b * b;
+    factor_type const b3 = b2 * b;
+    factor_type const b4 = b2 * b2;
+
+    std::size_t i = 0;
+    for (; i + 4 <= input.size(); i += 4) {
+      value_type const xs = b3 * input[i] + b2 * input[i + 1]
+                          + b * input[i + 2] + input[i + 3];
+      output_ = b4 * output_ + a * xs;
+    }
+    for (; i < input.size(); ++i) {
+      push(input[i]);
+    }
+  }
+
+  // Block push that also stores the output after every sample;
+  // output.size() must be at least input.size().
+  constexpr void
+  push(std::span<value_type const> input, std::span<value_type> output) {
+    ASSUME(output.size() >= input.size());
+    for (std::size_t i = 0; i < input.size(); ++i) {
+      push(input[i]);
+      output[i] = output_;
+    }
+  }
+
   constexpr const_reference output() const {
     return output_;
   }
@@ -51,20 +89,82 @@ public:
   set_smoothing(duration_type sampling_period, duration_type time_constant) {
     sampling_period_ = sampling_period;
     time_constant_ = time_constant;
-    smooth_factor_ = std::clamp(
-        sampling_period / time_constant,
-        factor_type(0),
-        factor_type(1)
-    );
+    smooth_factor_ = detail::smooth_factor(sampling_period, time_constant);
+  }
+
+  constexpr void set_timestep(duration_type ts) {
+    sampling_period_ = ts;
+    smooth_factor_ = detail::smooth_factor(sampling_period_, time_constant_);
+  }
+
+  constexpr factor_type smooth_factor() const {
+    return smooth_factor_;
+  }
+};
+
+// Lane-parallel exponential_filter: one smoothing factor shared by all
+// phases of a frame, states contiguous, one loop over phases per push.
+// Models some_filter with value_type = std::array<T, Phases>.
+template<typename T, typename Duration, std::size_t Phases>
+  requires(Phases > 0)
+class polyphase_exponential_filter {
+public:
+  using value_type = std::array<T, Phases>;
+  using reference = value_type&;
+  using const_reference = value_type const&;
+  using duration_type = Duration;
+  using factor_type =
+      decltype(std::declval<Duration>() / std::declval<Duration>());
+  static constexpr std::size_t phase_count = Phases;
+private:
+  duration_type sampling_period_;
+  duration_type time_constant_;
+  factor_type smooth_factor_;
+  value_type init_output_;
+  value_type output_;
+public:
+  constexpr polyphase_exponential_filter(
+      duration_type sampling_period,
+      duration_type time_constant,
+      value_type const& init_output = value_type()
+  )
+      : init_output_(init_output) {
+    set_smoothing(sampling_period, time_constant);
+    reset();
+  }
+
+  constexpr void push(value_type const& input_v) {
+    for (std::size_t p = 0; p < Phases; ++p) {
+      output_[p] = output_[p] + smooth_factor_ * (input_v[p] - output_[p]);
+    }
+  }
+
+  constexpr const_reference output() const {
+    return output_;
+  }
+
+  constexpr T const& output(std::size_t phase) const {
+    return output_[phase];
+  }
+
+  constexpr void set_output(value_type const& output_v) {
+    output_ = output_v;
+  }
+
+  constexpr void reset() {
+    set_output(init_output_);
+  }
+
+  constexpr void
+  set_smoothing(duration_type sampling_period, duration_type time_constant) {
+    sampling_period_ = sampling_period;
+    time_constant_ = time_constant;
+    smooth_factor_ = detail::smooth_factor(sampling_period, time_constant);
   }
 
   constexpr void set_timestep(duration_type ts) {
     sampling_period_ = ts;
-    smooth_factor_ = std::clamp(
-        sampling_period_ / time_constant_,
-        factor_type(0),
-        factor_type(1)
-    );
+    smooth_factor_ = detail::smooth_factor(sampling_period_, time_constant_);
   }
 
   constexpr factor_type smooth_factor() const {
@@ -1,10 +1,11 @@
 #pragma once
 
-#include <emb/container/circular_buffer.hpp>
+#include <emb/assert.hpp>
+#include <emb/filter/detail/median_window.hpp>
+#include <emb/filter/detail/smooth_factor.hpp>
 #include <emb/math.hpp>
 
-#include <algorithm>
-#include <array>
+#include <span>
 
 namespace emb {
 
@@ -20,7 +21,7 @@ public:
       decltype(std::declval<Duration>() / std::declval<Duration>());
   static constexpr std::size_t window_size = WindowSize;
 private:
-  emb::circular_buffer<value_type, window_size> window_;
+  detail::median_window<value_type, window_size> window_;
   duration_type sampling_period_;
   duration_type time_constant_;
   factor_type smooth_factor_;
@@ -38,17 +39,29 @@ public:
   }
 
   constexpr void push(value_type const& input_v) {
-    window_.push_back(input_v);
-    std::array<value_type, window_size> window_sorted = {};
-    for (auto i = 0uz; i < window_.size(); ++i) {
-      window_sorted[i] = window_[i];
-    }
-    std::sort(window_sorted.begin(), window_sorted.end());
-    value_type const median_v = window_sorted[window_size / 2];
+    window_.push(input_v);
+    value_type const median_v = window_.median();
 
     output_ = output_ + smooth_factor_ * (median_v - output_);
   }
 
+  constexpr void push(std::span<value_type const> input) {
+    for (auto const& v : input) {
+      push(v);
+    }
+  }
+
+  // Block push that also stores the output after every sample;
+  // output.size() must be at least input.size().
+  constexpr void
+  push(std::span<value_type const> input, std::span<value_type> output) {
+    ASSUME(output.size() >= input.size());
+    for (std::size_t i = 0; i < input.size(); ++i) {
+      push(input[i]);
+      output[i] = output_;
+    }
+  }
+
   constexpr const_reference output() const {
     return output_;
   }
@@ -66,20 +79,12 @@ public:
   set_smoothing(duration_type sampling_period, duration_type time_constant) {
     sampling_period_ = sampling_period;
     time_constant_ = time_constant;
-    smooth_factor_ = std::clamp(
-        sampling_period / time_constant,
-        factor_type(0),
-        factor_type(1)
-    );
+    smooth_factor_ = detail::smooth_factor(sampling_period, time_constant);
   }
 
   constexpr void set_timestep(duration_type ts) {
     sampling_period_ = ts;
-    smooth_factor_ = std::clamp(
-        sampling_period_ / time_constant_,
-        factor_type(0),
-        factor_type(1)
-    );
+    smooth_factor_ = detail::smooth_factor(sampling_period_, time_constant_);
   }
 
   constexpr factor_type smooth_factor() const {
@@ -0,0 +1,218 @@
+#pragma once
+
+#include <emb/assert.hpp>
+#include <emb/filter/biquad_design.hpp>
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+namespace emb {
+
+// IIR filter as a cascade of second-order sections in transposed Direct
+// Form II: per section and sample
+//   y  = b0*x + z1
+//   z1 = b1*x - a1*y + z2
+//   z2 = b2*x - a2*y
+// Two state values per section; the transposed form keeps the state close
+// to the signal level, which suits float arithmetic.
+template<typename T, std::size_t Sections>
+  requires(Sections > 0)
+class iir_sos_filter {
+public:
+  using value_type = T;
+  using reference = value_type&;
+  using const_reference = value_type const&;
+  using coefficients_type = std::array<biquad_coefficients, Sections>;
+  static constexpr std::size_t section_count = Sections;
+private:
+  struct section_state {
+    value_type z1;
+    value_type z2;
+  };
+
+  coefficients_type sos_;
+  std::array<section_state, Sections> state_{};
+  value_type init_output_;
+  value_type output_;
+public:
+  constexpr explicit iir_sos_filter(
+      coefficients_type const& sos,
+      value_type const& init_output = value_type()
+  )
+      : sos_(sos), init_output_(init_output) {
+    reset();
+  }
+
+  constexpr void push(value_type const& input_v) {
+    value_type x = input_v;
+    for (std::size_t k = 0; k < Sections; ++k) {
+      auto const& c = sos_[k];
+      auto& s = state_[k];
+      value_type const y = c.b0 * x + s.z1;
+      s.z1 = c.b1 * x - c.a1 * y + s.z2;
+      s.z2 = c.b2 * x - c.a2 * y;
+      x = y;
+    }
+    output_ = x;
+  }
+
+  constexpr void push(std::span<value_type const> input) {
+    for (auto const& v : input) {
+      push(v);
+    }
+  }
+
+  // Block push that also stores the output after every sample;
+  // output.size() must be at least input.size().
+  constexpr void
+  push(std::span<value_type const> input, std::span<value_type> output) {
+    ASSUME(output.size() >= input.size());
+    for (std::size_t i = 0; i < input.size(); ++i) {
+      push(input[i]);
+      output[i] = output_;
+    }
+  }
+
+  constexpr const_reference output() const {
+    return output_;
+  }
+
+  // Primes every section with its steady state for a constant input equal
+  // to output_v, so the filter starts settled on that input. output() is
+  // then the primed steady state, output_v times the cascade's DC gain:
+  // output_v for a unity-DC-gain design (low-pass, notch), 0 for a high-pass
+  // or band-pass.
+  constexpr void set_output(value_type const& output_v) {
+    value_type x = output_v;
+    for (std::size_t k = 0; k < Sections; ++k) {
+      auto const& c = sos_[k];
+      value_type const y = c.dc_gain() * x;
+      state_[k].z2 = c.b2 * x - c.a2 * y;
+      state_[k].z1 = c.b1 * x - c.a1 * y + state_[k].z2;
+      x = y;
+    }
+    output_ = x;
+  }
+
+  constexpr void reset() {
+    set_output(init_output_);
+  }
+
+  constexpr coefficients_type const& coefficients() const {
+    return sos_;
+  }
+
+  // Swaps the design without touching the state, e.g. to retune a notch.
+  constexpr void set_coefficients(coefficients_type const& sos) {
+    sos_ = sos;
+  }
+};
+
+// Lane-parallel iir_sos_filter: the same section cascade applied to every
+// phase of a frame. The state is stored section-major with the phases
+// contiguous, and each section update is unrolled over the phases with no
+// cross-phase dependency, so the lanes stay in registers. Models
+// some_filter with value_type = std::array<T, Phases>.
+template<typename T, std::size_t Sections, std::size_t Phases>
+  requires(Sections > 0 && Phases > 0)
+class polyphase_iir_sos_filter {
+public:
+  using value_type = std::array<T, Phases>;
+  using reference = value_type&;
+  using const_reference = value_type const&;
+  using coefficients_type = std::array<biquad_coefficients, Sections>;
+  static constexpr std::size_t section_count = Sections;
+  static constexpr std::size_t phase_count = Phases;
+private:
+  coefficients_type sos_;
+  std::array<value_type, Sections> z1_{};
+  std::array<value_type, Sections> z2_{};
+  value_type init_output_;
+  value_type output_;
+public:
+  constexpr explicit polyphase_iir_sos_filter(
+      coefficients_type const& sos,
+      value_type const& init_output = value_type()
+  )
+      : sos_(sos), init_output_(init_output) {
+    reset();
+  }
+
+  constexpr void push(value_type const& input_v) {
+    value_type x = input_v;
+    for (std::size_t k = 0; k < Sections; ++k) {
+      auto const c = sos_[k];
+      auto& z1 = z1_[k];
+      auto& z2 = z2_[k];
+      [&]<std::size_t... P>(std::index_sequence<P...>) {
+        ((x[P] = step(c, x[P], z1[P], z2[P])), ...);
+      }(std::make_index_sequence<Phases>{});
+    }
+    output_ = x;
+  }
+
+  constexpr void push(std::span<value_type const> input) {
+    for (auto const& v : input) {
+      push(v);
+    }
+  }
+
+  // Block push that also stores the output after every frame;
+  // output.size() must be at least input.size().
+  constexpr void
+  push(std::span<value_type const> input, std::span<value_type> output) {
+    ASSUME(output.size() >= input.size());
+    for (std::size_t i = 0; i < input.size(); ++i) {
+      push(input[i]);
+      output[i] = output_;
+    }
+  }
+
+  constexpr const_reference output() const {
+    return output_;
+  }
+
+  constexpr T output(std::size_t phase) const {
+    return output_[phase];
+  }
+
+  // See iir_sos_filter::set_output; applied per phase.
+  constexpr void set_output(value_type const& output_v) {
+    value_type x = output_v;
+    for (std::size_t k = 0; k < Sections; ++k) {
+      auto const c = sos_[k];
+      float const g = c.dc_gain();
+      for (std::size_t p = 0; p < Phases; ++p) {
+        T const y = g * x[p];
+        z2_[k][p] = c.b2 * x[p] - c.a2 * y;
+        z1_[k][p] = c.b1 * x[p] - c.a1 * y + z2_[k][p];
+        x[p] = y;
+      }
+    }
+    output_ = x;
+  }
+
+  constexpr void reset() {
+    set_output(init_output_);
+  }
+
+  constexpr coefficients_type const& coefficients() const {
+    return sos_;
+  }
+
+  constexpr void set_coefficients(coefficients_type const& sos) {
+    sos_ = sos;
+  }
+private:
+  static constexpr T
+  step(biquad_coefficients const& c, T x, T& z1, T& z2) {
+    T const y = c.b0 * x + z1;
+    z1 = c.b1 * x - c.a1 * y + z2;
+    z2 = c.b2 * x - c.a2 * y;
+    return y;
+  }
+};
+
+} // namespace emb
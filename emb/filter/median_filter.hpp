@@ -1,10 +1,10 @@
 #pragma once
 
-#include <emb/container/circular_buffer.hpp>
+#include <emb/assert.hpp>
+#include <emb/filter/detail/median_window.hpp>
 #include <emb/math.hpp>
 
-#include <algorithm>
-#include <array>
+#include <span>
 
 namespace emb {
 
@@ -17,7 +17,7 @@ public:
   using const_reference = value_type const&;
   static constexpr std::size_t window_size = WindowSize;
 private:
-  emb::circular_buffer<value_type, window_size> window_;
+  detail::median_window<value_type, window_size> window_;
   value_type init_output_;
   value_type output_;
 public:
@@ -27,13 +27,25 @@ public:
   }
 
   constexpr void push(value_type const& input_v) {
-    window_.push_back(input_v);
-    std::array<value_type, window_size> window_sorted = {};
-    for (auto i = 0uz; i < window_.size(); ++i) {
-      window_sorted[i] = window_[i];
+    window_.push(input_v);
+    output_ = window_.median();
+  }
+
+  constexpr void push(std::span<value_type const> input) {
+    for (auto const& v : input) {
+      push(v);
+    }
+  }
+
+  // Block push that also stores the output after every sample;
+  // output.size() must be at least input.size().
+  constexpr void
+  push(std::span<value_type const> input, std::span<value_type> output) {
+    ASSUME(output.size() >= input.size());
+    for (std::size_t i = 0; i < input.size(); ++i) {
+      push(input[i]);
+      output[i] = output_;
     }
-    std::sort(window_sorted.begin(), window_sorted.end());
-    output_ = window_sorted[window_size / 2];
   }
 
   constexpr const_reference output() const {
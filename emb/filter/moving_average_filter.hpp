@@ -2,13 +2,85 @@
 
 #include <algorithm>
 #include <emb/algorithm.hpp>
+#include <emb/assert.hpp>
 #include <emb/container/circular_buffer.hpp>
 #include <emb/math.hpp>
 #include <emb/units.hpp>
 
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+
 namespace emb {
 
-template<typename T, std::size_t WindowSize>
+namespace detail {
+
+// Default running-sum type of moving_average_filter. Integer samples (raw
+// ADC codes) are summed in a wider integer of the same signedness, so the sum
+// is exact and never drifts; other types (float, units) sum in place.
+template<typename T>
+struct moving_average_accumulator {
+  using type = T;
+};
+
+template<std::integral T>
+struct moving_average_accumulator<T> {
+  using type = std::conditional_t<
+      (sizeof(T) < sizeof(std::int32_t)),
+      std::conditional_t<
+          std::is_signed_v<T>,
+          std::int32_t,
+          std::uint32_t>,
+      std::conditional_t<
+          std::is_signed_v<T>,
+          std::int64_t,
+          std::uint64_t>>;
+};
+
+// True if a full window of the most extreme samples -- largest and, for
+// signed samples, most negative -- cannot overflow Accumulator. Signed samples
+// never go into an unsigned accumulator. An accumulator of the sample's own
+// width and signedness (e.g. int64_t samples, which have nothing wider) is
+// accepted without the range check: ruling out a window of near-limit samples
+// is then left to the caller.
+template<typename T, typename Accumulator, std::size_t WindowSize>
+consteval bool moving_average_accumulator_fits() {
+  if constexpr (!std::integral<T> || !std::integral<Accumulator>) {
+    return true;
+  } else if constexpr (
+      std::is_signed_v<T> && std::is_unsigned_v<Accumulator>
+  ) {
+    return false;
+  } else if constexpr (
+      sizeof(T) == sizeof(Accumulator)
+      && std::is_signed_v<T> == std::is_signed_v<Accumulator>
+  ) {
+    return true;
+  } else {
+    using sample_limits = std::numeric_limits<T>;
+    using sum_limits = std::numeric_limits<Accumulator>;
+    return std::cmp_less_equal(
+               sample_limits::max(),
+               sum_limits::max() / WindowSize
+           )
+        && std::cmp_greater_equal(
+               sample_limits::min(),
+               sum_limits::min() / static_cast<Accumulator>(WindowSize)
+           );
+  }
+}
+
+} // namespace detail
+
+template<
+    typename T,
+    std::size_t WindowSize,
+    typename Accumulator =
+        typename detail::moving_average_accumulator<T>::type>
 class moving_average_filter {
 public:
   using value_type = T;
@@ -16,12 +88,21 @@ public:
   using reference = value_type&;
   using const_reference = value_type const&;
   using underlying_type = emb::circular_buffer<value_type, WindowSize>;
+  using accumulator_type = Accumulator;
   using divider_type =
       decltype(std::declval<value_type>() / std::declval<value_type>());
   static constexpr std::size_t window_size = WindowSize;
+
+  static_assert(
+      detail::moving_average_accumulator_fits<
+          value_type,
+          accumulator_type,
+          window_size>(),
+      "accumulator_type cannot hold the sum of a full window of samples"
+  );
 private:
   underlying_type data_;
-  value_type sum_;
+  accumulator_type sum_;
   value_type init_output_;
   value_type output_;
 public:
@@ -40,7 +121,62 @@ public:
       sum_ = sum_ - data_.front() + input_v;
       data_.push_back(input_v);
     }
-    output_ = sum_ / static_cast<divider_type>(data_.size());
+    output_ = mean();
+  }
+
+  // Block push. Once the window is full the new sum follows from two
+  // independent reductions -- the block's last window_size inputs when the
+  // block covers the whole window (which also discards accumulated rounding),
+  // otherwise the old sum plus the block minus the evicted samples -- so
+  // there is no per-sample dependency chain. Only the last window_size
+  // inputs are written back into the window.
+  constexpr void push(std::span<value_type const> input) {
+    input = fill_window(input);
+    if (input.empty()) return;
+
+    std::size_t const n = input.size();
+    if (n >= window_size) {
+      sum_ = sum_of(input.last(window_size));
+    } else {
+      accumulator_type evicted{0};
+      for (std::size_t i = 0; i < n; ++i) {
+        evicted += data_[i];
+      }
+      sum_ = sum_ + sum_of(input) - evicted;
+    }
+    store_tail(input);
+    output_ = mean();
+  }
+
+  // Block push that also stores the output after every sample;
+  // output.size() must be at least input.size(). The running sum is a prefix
+  // sum over (input[i] - evicted[i]), where the evicted sample is read from
+  // the window for the first window_size inputs and from the block itself
+  // afterwards.
+  constexpr void
+  push(std::span<value_type const> input, std::span<value_type> output) {
+    ASSUME(output.size() >= input.size());
+    std::size_t head = 0;
+    for (; head < input.size() && !data_.full(); ++head) {
+      push(input[head]);
+      output[head] = output_;
+    }
+    input = input.subspan(head);
+    output = output.subspan(head);
+    if (input.empty()) return;
+
+    std::size_t const n = input.size();
+    std::size_t const split = std::min(n, window_size);
+    for (std::size_t i = 0; i < split; ++i) {
+      sum_ = sum_ + input[i] - data_[i];
+      output[i] = mean();
+    }
+    for (std::size_t i = split; i < n; ++i) {
+      sum_ = sum_ + input[i] - input[i - window_size];
+      output[i] = mean();
+    }
+    store_tail(input);
+    output_ = output[n - 1];
   }
 
   constexpr const_reference output() const {
@@ -49,7 +185,7 @@ public:
 
   constexpr void set_output(value_type const& output_v) {
     data_.clear();
-    sum_ = value_type{0};
+    sum_ = accumulator_type{0};
     output_ = output_v;
   }
 
@@ -60,6 +196,57 @@ public:
   constexpr underlying_type const& data() const {
     return data_;
   }
+private:
+  // Integer sums over a full window divide by the constant window_size: an
+  // explicit shift for unsigned sums and power-of-two windows, a division by
+  // a compile-time constant (lowered to shift/multiply) otherwise.
+  constexpr value_type mean() const {
+    if constexpr (std::integral<accumulator_type>) {
+      if (data_.full()) {
+        if constexpr (std::unsigned_integral<accumulator_type>
+                      && std::has_single_bit(window_size)) {
+          return static_cast<value_type>(
+              sum_ >> std::countr_zero(window_size)
+          );
+        } else {
+          return static_cast<value_type>(
+              sum_ / static_cast<accumulator_type>(window_size)
+          );
+        }
+      }
+      return static_cast<value_type>(
+          sum_ / static_cast<accumulator_type>(data_.size())
+      );
+    } else {
+      return sum_ / static_cast<divider_type>(data_.size());
+    }
+  }
+
+  // Pushes samples one by one until the window is full; returns the rest.
+  constexpr std::span<value_type const>
+  fill_window(std::span<value_type const> input) {
+    std::size_t i = 0;
+    for (; i < input.size() && !data_.full(); ++i) {
+      push(input[i]);
+    }
+    return input.subspan(i);
+  }
+
+  static constexpr accumulator_type
+  sum_of(std::span<value_type const> input) {
+    accumulator_type sum{0};
+    for (auto const& v : input) {
+      sum += v;
+    }
+    return sum;
+  }
+
+  constexpr void store_tail(std::span<value_type const> input) {
+    auto const tail = input.last(std::min(input.size(), window_size));
+    for (auto const& v : tail) {
+      data_.push_back(v);
+    }
+  }
 };
 
 } // namespace emb
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <emb/assert.hpp>
+
+#include <algorithm>
+#include <span>
+
 namespace emb {
 
 // Identity filter: holds the most recent value without smoothing. Useful where
@@ -21,6 +26,21 @@ public:
     value_ = input_v;
   }
 
+  constexpr void push(std::span<value_type const> input) {
+    if (!input.empty()) {
+      value_ = input.back();
+    }
+  }
+
+  // Block push that also stores the output after every sample;
+  // output.size() must be at least input.size().
+  constexpr void
+  push(std::span<value_type const> input, std::span<value_type> output) {
+    ASSUME(output.size() >= input.size());
+    std::copy(input.begin(), input.end(), output.begin());
+    push(input);
+  }
+
   constexpr const_reference output() const {
     return value_;
   }
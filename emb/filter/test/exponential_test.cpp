@@ -1,6 +1,9 @@
 #include <emb/filter/exponential_filter.hpp>
 #include <emb/units.hpp>
 
+#include <array>
+#include <span>
+
 namespace {
 
 template<typename Filter>
@@ -78,4 +81,70 @@ static_assert(test_exponential_filter(
     emb::units::erad_f32{0}
 ));
 
+// The unrolled block push reorders the arithmetic, so it matches the
+// per-sample recurrence only up to rounding.
+constexpr bool test_exponential_block_push() {
+  using filter_type = emb::exponential_filter<float, emb::units::sec_f32>;
+  constexpr auto near = [](float a, float b) {
+    return (a - b) < 1e-3f && (b - a) < 1e-3f;
+  };
+
+  std::array<float, 23> input{};
+  for (auto i = 0uz; i < input.size(); ++i) {
+    input[i] = static_cast<float>((i * 5) % 11);
+  }
+
+  filter_type scalar(emb::units::sec_f32{0.01f}, emb::units::sec_f32{0.05f});
+  filter_type blocked = scalar;
+  filter_type blocked_out = scalar;
+  std::array<float, input.size()> output{};
+
+  blocked.push(input);
+  blocked_out.push(input, output);
+  for (auto i = 0uz; i < input.size(); ++i) {
+    scalar.push(input[i]);
+    assert(output[i] == scalar.output());
+  }
+  assert(near(blocked.output(), scalar.output()));
+  assert(blocked_out.output() == scalar.output());
+  return true;
+}
+
+static_assert(test_exponential_block_push());
+
+// Every lane of the polyphase filter follows its own scalar filter exactly.
+constexpr bool test_polyphase_exponential_filter() {
+  using scalar_type = emb::exponential_filter<float, emb::units::sec_f32>;
+  using filter_type =
+      emb::polyphase_exponential_filter<float, emb::units::sec_f32, 3>;
+  constexpr emb::units::sec_f32 period{0.01f};
+  constexpr emb::units::sec_f32 tau{0.05f};
+
+  filter_type filter(period, tau, {1.0f, 2.0f, 3.0f});
+  std::array<scalar_type, 3> lanes{
+      scalar_type(period, tau, 1.0f),
+      scalar_type(period, tau, 2.0f),
+      scalar_type(period, tau, 3.0f)
+  };
+
+  for (auto i = 0uz; i < 17; ++i) {
+    std::array<float, 3> const frame{
+        static_cast<float>(i % 5),
+        static_cast<float>((i * 3) % 7),
+        -static_cast<float>(i)
+    };
+    filter.push(frame);
+    for (auto p = 0uz; p < 3; ++p) {
+      lanes[p].push(frame[p]);
+      assert(filter.output(p) == lanes[p].output());
+    }
+  }
+
+  filter.reset();
+  assert((filter.output() == std::array{1.0f, 2.0f, 3.0f}));
+  return true;
+}
+
+static_assert(test_polyphase_exponential_filter());
+
 } // namespace
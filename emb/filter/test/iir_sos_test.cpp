@@ -0,0 +1,155 @@
+#include <emb/filter/iir_sos_filter.hpp>
+#include <emb/units.hpp>
+
+#include <array>
+#include <cstddef>
+#include <numbers>
+
+namespace {
+
+constexpr emb::units::sec_f32 ts{1.0f / 10000.0f};
+
+constexpr bool near(float a, float b, float tol) {
+  return (a - b) < tol && (b - a) < tol;
+}
+
+// Peak |output| over the last quarter of a run driven by a unit sine.
+template<typename Filter>
+constexpr float sine_response(Filter filter, float freq, std::size_t samples) {
+  float peak = 0.0f;
+  for (std::size_t i = 0; i < samples; ++i) {
+    float const phase = 2 * std::numbers::pi_v<float> * freq
+                      * ts.value() * static_cast<float>(i);
+    filter.push(emb::sin(emb::norm2pi(phase)));
+    if (i >= samples - samples / 4) {
+      float const y = filter.output();
+      peak = y > peak ? y : (-y > peak ? -y : peak);
+    }
+  }
+  return peak;
+}
+
+// Designs are usable as compile-time constants.
+constexpr auto lp4 =
+    emb::butterworth_lowpass<2>(emb::units::hz_f32{200.0f}, ts);
+constexpr auto hp2 =
+    emb::butterworth_highpass<1>(emb::units::hz_f32{200.0f}, ts);
+
+static_assert(near(lp4[0].dc_gain(), 1.0f, 1e-4f));
+static_assert(near(lp4[1].dc_gain(), 1.0f, 1e-4f));
+static_assert(near(hp2[0].dc_gain(), 0.0f, 1e-4f));
+
+constexpr bool test_iir_sos_filter() {
+  emb::iir_sos_filter<float, 2> filter(lp4);
+  assert(filter.output() == 0.0f);
+
+  // step response settles on the input
+  for (int i = 0; i < 1000; ++i) {
+    filter.push(1.0f);
+  }
+  assert(near(filter.output(), 1.0f, 1e-3f));
+
+  // primed state: a constant input equal to the output stays put
+  filter.set_output(-42.0f);
+  assert(near(filter.output(), -42.0f, 1e-3f));
+  filter.push(-42.0f);
+  assert(near(filter.output(), -42.0f, 1e-3f));
+
+  filter.reset();
+  assert(filter.output() == 0.0f);
+
+  // pass band / stop band of the 4th-order low-pass
+  assert(near(sine_response(filter, 20.0f, 2000), 1.0f, 0.02f));
+  assert(sine_response(filter, 2000.0f, 2000) < 0.002f);
+  return true;
+}
+
+static_assert(test_iir_sos_filter());
+
+// Priming a zero-DC-gain design reports the steady state it settles on, 0,
+// not the constant input it was primed for.
+constexpr bool test_iir_sos_prime_highpass() {
+  emb::iir_sos_filter<float, 1> filter(hp2, 5.0f);
+  assert(near(filter.output(), 0.0f, 1e-4f));
+  for (int i = 0; i < 10; ++i) {
+    filter.push(5.0f);
+    assert(near(filter.output(), 0.0f, 1e-4f));
+  }
+
+  filter.set_output(-3.0f);
+  assert(near(filter.output(), 0.0f, 1e-4f));
+  filter.push(-3.0f);
+  assert(near(filter.output(), 0.0f, 1e-4f));
+  return true;
+}
+
+static_assert(test_iir_sos_prime_highpass());
+
+constexpr bool test_iir_sos_notch_bandpass() {
+  constexpr emb::units::hz_f32 f0{50.0f};
+  emb::iir_sos_filter<float, 1> notch(
+      {emb::notch_biquad(f0, ts, 2.0f)}
+  );
+  emb::iir_sos_filter<float, 1> bandpass(
+      {emb::bandpass_biquad(f0, ts, 2.0f)}
+  );
+
+  assert(sine_response(notch, 50.0f, 4000) < 0.02f);
+  assert(near(sine_response(notch, 500.0f, 4000), 1.0f, 0.02f));
+  assert(near(sine_response(bandpass, 50.0f, 4000), 1.0f, 0.02f));
+  assert(sine_response(bandpass, 1000.0f, 4000) < 0.06f);
+  return true;
+}
+
+static_assert(test_iir_sos_notch_bandpass());
+
+// The lane-parallel variant computes the same as one filter per phase.
+constexpr bool test_polyphase_iir_sos_filter() {
+  using frame = std::array<float, 3>;
+  emb::polyphase_iir_sos_filter<float, 2, 3> bank(lp4);
+  std::array<emb::iir_sos_filter<float, 2>, 3> phases{
+      emb::iir_sos_filter<float, 2>(lp4),
+      emb::iir_sos_filter<float, 2>(lp4),
+      emb::iir_sos_filter<float, 2>(lp4)
+  };
+
+  for (int i = 0; i < 50; ++i) {
+    frame const in{
+        static_cast<float>(i % 7),
+        static_cast<float>(-i % 5),
+        static_cast<float>(i * i % 11)
+    };
+    bank.push(in);
+    for (auto p = 0uz; p < 3; ++p) {
+      phases[p].push(in[p]);
+      assert(bank.output(p) == phases[p].output());
+    }
+  }
+
+  bank.set_output(frame{1.0f, 2.0f, 3.0f});
+  phases[0].set_output(1.0f);
+  for (auto p = 0uz; p < 3; ++p) {
+    assert(near(bank.output(p), static_cast<float>(p + 1), 1e-3f));
+  }
+  assert(bank.output(0) == phases[0].output());
+
+  emb::polyphase_iir_sos_filter<float, 1, 3> hp_bank(hp2);
+  hp_bank.set_output(frame{1.0f, 2.0f, 3.0f});
+  for (auto p = 0uz; p < 3; ++p) {
+    assert(near(hp_bank.output(p), 0.0f, 1e-4f));
+  }
+  return true;
+}
+
+static_assert(test_polyphase_iir_sos_filter());
+
+// Works with units as value_type.
+static_assert([] {
+  emb::iir_sos_filter<emb::units::erad_f32, 2> filter(lp4);
+  for (int i = 0; i < 1000; ++i) {
+    filter.push(emb::units::erad_f32{2.0f});
+  }
+  return near(filter.output().value(), 2.0f, 1e-3f);
+}());
+
+} // namespace
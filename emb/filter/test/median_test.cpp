@@ -1,6 +1,10 @@
 #include <emb/filter/median_filter.hpp>
 #include <emb/units.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
 namespace {
 
 template<typename Filter>
@@ -57,6 +61,72 @@ constexpr bool test_median_filter(
   return true;
 }
 
+// Checks the incrementally sorted window against a copy-and-sort reference
+// over a pseudo-random sequence with plenty of duplicates.
+template<std::size_t WindowSize>
+constexpr bool test_median_filter_reference() {
+  emb::median_filter<int, WindowSize> filter;
+  std::array<int, WindowSize> window{};
+
+  std::uint32_t seed = 12345;
+  for (auto i = 0uz; i < 8 * WindowSize + 16; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    int const v = static_cast<int>((seed >> 16) % 17) - 8;
+
+    std::shift_left(window.begin(), window.end(), 1);
+    window.back() = v;
+    filter.push(v);
+
+    auto sorted = window;
+    std::sort(sorted.begin(), sorted.end());
+    assert(filter.output() == sorted[WindowSize / 2]);
+  }
+  return true;
+}
+
+static_assert(test_median_filter_reference<1>());
+static_assert(test_median_filter_reference<3>());
+static_assert(test_median_filter_reference<5>());
+static_assert(test_median_filter_reference<7>());
+static_assert(test_median_filter_reference<9>());
+static_assert(test_median_filter_reference<11>());
+static_assert(test_median_filter_reference<15>());
+static_assert(test_median_filter_reference<31>());
+
+// Lane-parallel median: every lane of an std::array sample is filtered
+// independently by the same network.
+constexpr bool test_median_filter_lanes() {
+  using lanes = std::array<int, 3>;
+  emb::median_filter<lanes, 5> filter;
+  filter.push(lanes{1, 100, -1});
+  filter.push(lanes{5, 400, -5});
+  filter.push(lanes{3, 200, -3});
+  assert((filter.output() == lanes{1, 100, -1}));
+  filter.push(lanes{4, 300, -4});
+  filter.push(lanes{2, 500, -2});
+  assert((filter.output() == lanes{3, 300, -3}));
+  return true;
+}
+
+static_assert(test_median_filter_lanes());
+
+constexpr bool test_median_block_push() {
+  std::array<int, 9> const input{4, -2, 7, 7, 0, 3, -5, 9, 1};
+  emb::median_filter<int, 5> scalar;
+  emb::median_filter<int, 5> blocked;
+  std::array<int, input.size()> output{};
+
+  blocked.push(input, output);
+  for (auto i = 0uz; i < input.size(); ++i) {
+    scalar.push(input[i]);
+    assert(output[i] == scalar.output());
+  }
+  assert(blocked.output() == scalar.output());
+  return true;
+}
+
+static_assert(test_median_block_push());
+
 // Test with int and various odd window sizes
 static_assert(test_median_filter(emb::median_filter<int, 1>{}, 0));
 static_assert(test_median_filter(emb::median_filter<int, 3>{}, 0));
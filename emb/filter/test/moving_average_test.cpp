@@ -1,6 +1,12 @@
 #include <emb/filter/moving_average_filter.hpp>
 #include <emb/units.hpp>
 
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <span>
+
 namespace {
 
 template<typename Filter>
@@ -88,4 +94,125 @@ static_assert(test_moving_average_filter(
     emb::units::erad_f32{0}
 ));
 
+// Block push must match pushing the same samples one by one, for blocks
+// shorter and longer than the window and starting from a partly filled one.
+template<std::size_t WindowSize>
+constexpr bool test_moving_average_block_push() {
+  std::array<int, 40> input{};
+  for (auto i = 0uz; i < input.size(); ++i) {
+    input[i] = static_cast<int>((i * 7) % 23) - 11;
+  }
+
+  for (auto block = 1uz; block <= 2 * WindowSize + 1; ++block) {
+    emb::moving_average_filter<int, WindowSize> scalar;
+    emb::moving_average_filter<int, WindowSize> blocked;
+    emb::moving_average_filter<int, WindowSize> blocked_out;
+    std::array<int, input.size()> output{};
+
+    for (auto i = 0uz; i < input.size(); i += block) {
+      auto const n = std::min(block, input.size() - i);
+      std::span<int const> const chunk(input.data() + i, n);
+      blocked.push(chunk);
+      blocked_out.push(chunk, std::span<int>(output.data() + i, n));
+      for (auto k = 0uz; k < n; ++k) {
+        scalar.push(input[i + k]);
+        assert(output[i + k] == scalar.output());
+      }
+      assert(blocked.output() == scalar.output());
+      assert(blocked_out.output() == scalar.output());
+    }
+  }
+  return true;
+}
+
+static_assert(test_moving_average_block_push<1>());
+static_assert(test_moving_average_block_push<4>());
+static_assert(test_moving_average_block_push<7>());
+
+// Raw ADC codes: the sum of a window of full-scale u16 codes overflows u16,
+// so it lives in the wider integer accumulator.
+constexpr bool test_moving_average_integer_codes() {
+  emb::moving_average_filter<std::uint16_t, 16> filter;
+  static_assert(std::same_as<
+                decltype(filter)::accumulator_type,
+                std::uint32_t>);
+
+  for (auto i = 0uz; i < 40; ++i) {
+    filter.push(std::uint16_t{0xffff});
+    assert(filter.output() == 0xffff);
+  }
+
+  // full power-of-two window: shift, equal to truncating division
+  std::uint32_t sum = 0;
+  for (auto i = 0uz; i < 16; ++i) {
+    auto const code = static_cast<std::uint16_t>(4095 - 3 * i);
+    filter.push(code);
+    sum += code;
+  }
+  assert(filter.output() == sum / 16);
+
+  // partly filled window divides by the current size
+  filter.reset();
+  filter.push(std::uint16_t{10});
+  filter.push(std::uint16_t{13});
+  filter.push(std::uint16_t{17});
+  assert(filter.output() == 40 / 3);
+  return true;
+}
+
+static_assert(test_moving_average_integer_codes());
+
+static_assert(std::same_as<
+              emb::moving_average_filter<std::int32_t, 8>::accumulator_type,
+              std::int64_t>);
+static_assert(std::same_as<
+              emb::moving_average_filter<float, 8>::accumulator_type,
+              float>);
+
+// 64-bit samples sum in the 64-bit accumulator, the widest available.
+static_assert(test_moving_average_filter(
+    emb::moving_average_filter<std::int64_t, 4>{},
+    std::int64_t{0}
+));
+static_assert(std::same_as<
+              emb::moving_average_filter<std::uint64_t, 4>::accumulator_type,
+              std::uint64_t>);
+
+// Both ends of the signed sample range are checked.
+static_assert(emb::detail::moving_average_accumulator_fits<
+              std::int16_t,
+              std::int32_t,
+              65536>());
+static_assert(!emb::detail::moving_average_accumulator_fits<
+              std::int16_t,
+              std::int32_t,
+              65537>());
+static_assert(!emb::detail::moving_average_accumulator_fits<
+              std::int8_t,
+              std::int16_t,
+              257>());
+static_assert(!emb::detail::moving_average_accumulator_fits<
+              std::int8_t,
+              std::uint32_t,
+              2>());
+
+// Signed samples are rejected by an unsigned accumulator of any width; the
+// same-width exemption covers matching signedness only.
+static_assert(!emb::detail::moving_average_accumulator_fits<
+              std::int16_t,
+              std::uint64_t,
+              4>());
+static_assert(!emb::detail::moving_average_accumulator_fits<
+              std::int64_t,
+              std::uint64_t,
+              4>());
+static_assert(!emb::detail::moving_average_accumulator_fits<
+              std::uint64_t,
+              std::int64_t,
+              4>());
+static_assert(emb::detail::moving_average_accumulator_fits<
+              std::uint16_t,
+              std::uint64_t,
+              4>());
+
 } // namespace
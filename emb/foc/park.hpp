@@ -19,5 +19,23 @@ constexpr vec_ab invpark_transform(vec_dq v_dq, float sine, float cosine) {
   };
 }
 
+// Compute emb::sincos(theta) once per control cycle and pass it to both
+// transforms.
+constexpr vec_dq park_transform(vec_ab v_ab, emb::sincos_pair sc) {
+  return park_transform(v_ab, sc.sin, sc.cos);
+}
+
+constexpr vec_ab invpark_transform(vec_dq v_dq, emb::sincos_pair sc) {
+  return invpark_transform(v_dq, sc.sin, sc.cos);
+}
+
+constexpr vec_dq park_transform(vec_ab v_ab, emb::turns theta) {
+  return park_transform(v_ab, emb::sincos(theta));
+}
+
+constexpr vec_ab invpark_transform(vec_dq v_dq, emb::turns theta) {
+  return invpark_transform(v_dq, emb::sincos(theta));
+}
+
 } // namespace foc
 } // namespace emb
@@ -2,6 +2,9 @@
 
 #include <emb/foc/types.hpp>
 #include <emb/math.hpp>
+#include <emb/math/batch.hpp>
+
+#include <span>
 
 namespace emb {
 namespace foc {
@@ -13,5 +16,17 @@ constexpr vec_polar to_polar(vec_ab arg) {
   };
 };
 
+// Many axes (or samples) at once, with the components in separate arrays:
+// mag[i] and theta[i] from alpha[i] and beta[i], through the batch kernels.
+inline void to_polar(
+    std::span<float const> alpha,
+    std::span<float const> beta,
+    std::span<float> mag,
+    std::span<float> theta
+) {
+  emb::magnitude_batch(alpha, beta, mag);
+  emb::atan2_batch(beta, alpha, theta);
+}
+
 } // namespace foc
 } // namespace emb
@@ -7,6 +7,8 @@
 
 namespace emb {
 
+// The phase is kept as an emb::turns accumulator, so each update is one
+// integer add that wraps by itself, and the output comes from emb::sincos.
 template<typename T>
 class sine_generator {
 public:
@@ -15,43 +17,59 @@ public:
 private:
   units::sec_f32 update_period_;
   value_type ampl_;
-  float wfreq_;
-  emb::units::rad_f32 init_phase_;
+  float freq_;
+  emb::turns step_;
+  emb::turns init_phase_;
   value_type bias_;
 
-  emb::units::rad_f32 phase_;
+  emb::turns phase_;
   value_type output_;
 public:
   constexpr sine_generator(
       units::sec_f32 const& update_period,
       value_type const& ampl,
       units::hz_f32 const& freq,
-      emb::units::rad_f32 const& init_phase = emb::units::rad_f32(0),
+      emb::turns init_phase,
       value_type bias = value_type()
   )
       : update_period_(update_period),
         ampl_(ampl),
-        wfreq_(2 * std::numbers::pi_v<float> * freq.value()),
+        freq_(freq.value()),
+        step_(emb::turns::from_fraction(freq.value() * update_period.value())
+        ),
         init_phase_(init_phase),
         bias_(bias) {
     assert(update_period.value() > 0);
     reset();
   }
 
+  constexpr sine_generator(
+      units::sec_f32 const& update_period,
+      value_type const& ampl,
+      units::hz_f32 const& freq,
+      emb::units::rad_f32 const& init_phase = emb::units::rad_f32(0),
+      value_type bias = value_type()
+  )
+      : sine_generator(
+            update_period,
+            ampl,
+            freq,
+            emb::turns::from_rad(init_phase.value()),
+            bias
+        ) {}
+
   constexpr const_reference output() const {
     return output_;
   }
 
   constexpr void reset() {
     phase_ = init_phase_;
-    output_ = ampl_ * emb::sin(phase_.value()) + bias_;
+    output_ = ampl_ * emb::sincos(phase_).sin + bias_;
   }
 
   constexpr void update() {
-    phase_ = emb::units::rad_f32(
-        emb::norm2pi(phase_.value() + wfreq_ * update_period_.value())
-    );
-    output_ = ampl_ * emb::sin(phase_.value()) + bias_;
+    phase_ += step_;
+    output_ = ampl_ * emb::sincos(phase_).sin + bias_;
   }
 
   constexpr units::sec_f32 update_period() const {
@@ -67,10 +85,15 @@ public:
   }
 
   constexpr float freq() const {
-    return wfreq_ / (2 * std::numbers::pi_v<float>);
+    return freq_;
   }
 
+  // In [0, 2pi).
   constexpr emb::units::rad_f32 phase() const {
+    return emb::units::rad_f32(phase_.to_rad());
+  }
+
+  constexpr emb::turns phase_turns() const {
     return phase_;
   }
 };
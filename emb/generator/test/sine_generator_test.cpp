@@ -68,4 +68,14 @@ static_assert(test_sine_generator(
     emb::units::convert_to<emb::units::rad_f32>(emb::units::deg_f32{42.0f})
 ));
 
+static_assert(test_sine_generator(
+    emb::sine_generator<float>{
+        emb::units::sec_f32{0.001f},
+        2.0f,
+        emb::units::hz_f32{50.0f},
+        emb::turns::from_fraction(0.75f)
+    },
+    emb::units::rad_f32{3 * std::numbers::pi_v<float> / 2}
+));
+
 } // namespace
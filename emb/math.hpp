@@ -3,6 +3,7 @@
 #include <emb/math/trigonometric.hpp>
 
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <cassert>
 #include <cfloat>
@@ -138,6 +139,155 @@ constexpr float sqrt(float arg) {
   }
 }
 
+namespace detail {
+
+// sqrt(v) for v in [1, 4) in double precision; for table generation only.
+constexpr double newton_sqrt(double v) {
+  double r = 1.5;
+  for (int i = 0; i < 8; ++i) {
+    r = 0.5 * (r + v / r);
+  }
+  return r;
+}
+
+// Mantissa table for lookup_sqrt: 128 steps over [1, 2) for even exponents,
+// then 128 over [2, 4) for odd ones. scale maps the float's [1, 2) mantissa m
+// to m_actual / m0, so t = m * scale - 1 is the relative offset from m0.
+struct sqrt_table_entry {
+  float root;
+  float scale;
+};
+
+inline constexpr auto sqrt_lookup_table = [] {
+  std::array<sqrt_table_entry, 256> table{};
+  for (std::size_t i = 0; i < table.size(); ++i) {
+    double const odd = i < 128 ? 1.0 : 2.0;
+    double const m0 = odd * (1.0 + static_cast<double>(i % 128) / 128.0);
+    table[i] = {
+        static_cast<float>(newton_sqrt(m0)),
+        static_cast<float>(odd / m0)
+    };
+  }
+  return table;
+}();
+
+} // namespace detail
+
+// sqrt from a 256-entry mantissa table with a second-order Taylor
+// correction, sqrt(m0 (1 + t)) = sqrt(m0) (1 + t/2 - t^2/8); the exponent is
+// halved exactly. Relative error about 2e-7 over the normal range.
+constexpr float lookup_sqrt(float arg) {
+  assert(arg >= 0.0f);
+  if (arg < FLT_MIN) return 0.0f;
+
+  auto const bits = std::bit_cast<std::uint32_t>(arg);
+  int const exp = static_cast<int>(bits >> 23) - 127;
+  int const odd = exp & 1;
+  float const m = std::bit_cast<float>((bits & 0x7f'ffffu) | 0x3f80'0000u);
+
+  std::size_t const idx = (std::size_t(odd) << 7) | ((bits >> 16) & 0x7f);
+  auto const e = detail::sqrt_lookup_table[idx];
+  float const t = m * e.scale - 1.0f;
+  float const root = e.root * (1.0f + t * (0.5f - 0.125f * t));
+
+  auto const half_exp = static_cast<std::uint32_t>((exp - odd) / 2 + 127);
+  return root * std::bit_cast<float>(half_exp << 23);
+}
+
+// ---- accuracy tiers ----
+// Implementation policies for sin/cos/atan2/sqrt, chosen per call site:
+// emb::sin<emb::poly_tier>(x). The untemplated functions above keep their
+// behavior (builtin at run time, lookup in constant evaluation). Max
+// absolute errors (sqrt: relative) as measured by bench/math_tier_bench:
+//   lut_tier      tables with Taylor correction   sin/cos 4.7e-7 (mostly
+//                                                 range reduction), atan2
+//                                                 2.8e-7, sqrt 2.2e-7
+//   poly_tier     no tables: minimax polynomials  sin/cos 1.7e-6, atan2
+//                 and Newton-refined rsqrt        2.4e-6, sqrt 4.8e-6
+//   builtin_tier  CMSIS-DSP on Arm, std:: on x86; during constant
+//                 evaluation the fallbacks of emb::sin/cos/atan2/sqrt
+template<typename T>
+concept some_math_tier = requires(float v) {
+  { T::sin(v) } -> std::same_as<float>;
+  { T::cos(v) } -> std::same_as<float>;
+  { T::atan2(v, v) } -> std::same_as<float>;
+  { T::sqrt(v) } -> std::same_as<float>;
+};
+
+struct lut_tier {
+  static constexpr float sin(float x) {
+    return lookup_sin(x);
+  }
+
+  static constexpr float cos(float x) {
+    return lookup_cos(x);
+  }
+
+  static constexpr float atan2(float y, float x) {
+    return lookup_atan2(y, x);
+  }
+
+  static constexpr float sqrt(float x) {
+    return lookup_sqrt(x);
+  }
+};
+
+struct poly_tier {
+  static constexpr float sin(float x) {
+    return poly_sin(x);
+  }
+
+  static constexpr float cos(float x) {
+    return poly_cos(x);
+  }
+
+  static constexpr float atan2(float y, float x) {
+    return fast_atan2(y, x);
+  }
+
+  static constexpr float sqrt(float x) {
+    return fast_sqrt(x);
+  }
+};
+
+struct builtin_tier {
+  static constexpr float sin(float x) {
+    return emb::sin(x);
+  }
+
+  static constexpr float cos(float x) {
+    return emb::cos(x);
+  }
+
+  static constexpr float atan2(float y, float x) {
+    return emb::atan2(y, x);
+  }
+
+  static constexpr float sqrt(float x) {
+    return emb::sqrt(x);
+  }
+};
+
+template<some_math_tier Tier>
+constexpr float sin(float x) {
+  return Tier::sin(x);
+}
+
+template<some_math_tier Tier>
+constexpr float cos(float x) {
+  return Tier::cos(x);
+}
+
+template<some_math_tier Tier>
+constexpr float atan2(float y, float x) {
+  return Tier::atan2(y, x);
+}
+
+template<some_math_tier Tier>
+constexpr float sqrt(float x) {
+  return Tier::sqrt(x);
+}
+
 // ---- fmod ----
 template<std::floating_point T>
 consteval T fmod_trivial(T x, T y) {
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <emb/assert.hpp>
+#include <emb/math/detail/simd.hpp>
+#include <emb/math/trigonometric.hpp>
+
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <span>
+
+namespace emb {
+namespace detail {
+
+// sin and cos of x through the same turns decomposition and table as
+// emb::sincos(turns), lane-wise. The angle is reduced to [-1/2, 1/2) turn by
+// subtracting the nearest whole turn, then scaled to the 2^32 counts of a
+// turn; a negative count wraps like turns::raw. The whole turn is rounded to
+// a 32-bit integer, so |x| must stay below 2^31 turns (about 1.3e10 rad).
+template<typename V>
+void sincos_lanes(
+    typename V::f32 x,
+    typename V::f32& sin_out,
+    typename V::f32& cos_out
+) {
+  using f32 = typename V::f32;
+  using i32 = typename V::i32;
+
+  f32 u = V::mul(x, V::splat(0.5f / std::numbers::pi_v<float>));
+  u = V::sub(u, V::to_float(V::round_to_int(u)));
+  i32 const raw = V::template shl<2>(
+      V::round_to_int(V::mul(u, V::splat(1073741824.0f)))
+  );
+
+  i32 const idx = V::iand(V::template shr<23>(raw), V::splat_i(0x7f));
+  f32 const z = V::mul(
+      V::to_float(V::iand(raw, V::splat_i(0x7fffff))),
+      V::splat(1.0f / 8388608.0f)
+  );
+  float const* table = sin_table<float, 128>.data();
+  f32 const sint = V::gather(table, idx);
+  f32 const cost = V::gather(table, V::isub(V::splat_i(128), idx));
+
+  // step_sincos
+  f32 const zz = V::mul(z, z);
+  f32 const ss = V::mul(
+      z,
+      V::add(
+          V::splat(0.012271846303085128928f),
+          V::mul(
+              zz,
+              V::add(
+                  V::splat(-3.0801968454884792651e-7f),
+                  V::mul(V::splat(2.3193461291439683491e-12f), zz)
+              )
+          )
+      )
+  );
+  f32 const cc = V::sub(
+      V::splat(1.0f),
+      V::mul(
+          zz,
+          V::add(
+              V::splat(0.000075299105843272081f),
+              V::mul(
+                  zz,
+                  V::add(
+                      V::splat(-9.449925567834354484e-10f),
+                      V::mul(V::splat(4.7437807891647010749e-15f), zz)
+                  )
+              )
+          )
+      )
+  );
+
+  f32 const s = V::add(V::mul(sint, cc), V::mul(cost, ss));
+  f32 const c = V::sub(V::mul(cost, cc), V::mul(sint, ss));
+
+  // rotate_quadrant without branches: odd quadrants map (s, c) to (c, -s),
+  // the lower half-turn bit then negates both.
+  i32 const sign_bit = V::splat_i(0x8000'0000);
+  i32 const odd = V::isub(
+      V::splat_i(0),
+      V::iand(V::template shr<30>(raw), V::splat_i(1))
+  );
+  f32 const neg_s = V::as_float(V::ixor(V::as_int(s), sign_bit));
+  i32 const flip = V::iand(raw, sign_bit);
+  sin_out = V::as_float(V::ixor(V::as_int(V::select(odd, c, s)), flip));
+  cos_out = V::as_float(V::ixor(V::as_int(V::select(odd, neg_s, c)), flip));
+}
+
+// On a single lane, branches are cheaper than masks: the scalar functions.
+template<>
+inline void sincos_lanes<simd::scalar_ops>(
+    float x,
+    float& sin_out,
+    float& cos_out
+) {
+  auto const [s, c] = sincos(x);
+  sin_out = s;
+  cos_out = c;
+}
+
+// fast_atan2, lane-wise; the octant folding of atan2_by_octant done with
+// min/max and masks. atan2(0, 0) is 0.
+template<typename V>
+typename V::f32 atan2_lanes(typename V::f32 y, typename V::f32 x) {
+  using f32 = typename V::f32;
+  using i32 = typename V::i32;
+  constexpr float pi = std::numbers::pi_v<float>;
+
+  i32 const sign_bit = V::splat_i(0x8000'0000);
+  i32 const abs_mask = V::splat_i(0x7fff'ffff);
+  f32 const ax = V::as_float(V::iand(V::as_int(x), abs_mask));
+  f32 const ay = V::as_float(V::iand(V::as_int(y), abs_mask));
+
+  i32 const swap = V::greater(ay, ax);
+  f32 const den = V::max(ax, ay);
+  f32 a = V::div(V::min(ax, ay), den);
+  a = V::select(V::greater(den, V::splat(0.0f)), a, V::splat(0.0f));
+
+  f32 const a2 = V::mul(a, a);
+  f32 r = V::splat(0.00986379869f);
+  r = V::add(V::mul(r, a2), V::splat(-0.04309138166f));
+  r = V::add(V::mul(r, a2), V::splat(0.09070502172f));
+  r = V::add(V::mul(r, a2), V::splat(-0.13833401501f));
+  r = V::add(V::mul(r, a2), V::splat(0.19957728206f));
+  r = V::add(V::mul(r, a2), V::splat(-0.33332251836f));
+  r = V::add(V::mul(r, a2), V::splat(0.99999997596f));
+  r = V::mul(r, a);
+
+  r = V::select(swap, V::sub(V::splat(pi / 2.0f), r), r);
+  r = V::select(V::less(x, V::splat(0.0f)), V::sub(V::splat(pi), r), r);
+  return V::as_float(
+      V::ixor(V::as_int(r), V::iand(V::less(y, V::splat(0.0f)), sign_bit))
+  );
+}
+
+template<>
+inline float atan2_lanes<simd::scalar_ops>(float y, float x) {
+  return fast_atan2(y, x);
+}
+
+// sqrt(a^2 + b^2) through fast_rsqrt, lane-wise; 0 below FLT_MIN, where
+// fast_rsqrt is undefined.
+template<typename V>
+typename V::f32 magnitude_lanes(typename V::f32 a, typename V::f32 b) {
+  using f32 = typename V::f32;
+
+  f32 const s = V::add(V::mul(a, a), V::mul(b, b));
+  f32 const half = V::mul(s, V::splat(0.5f));
+  f32 y = V::as_float(V::isub(
+      V::splat_i(0x5f3759df),
+      V::template shr<1>(V::as_int(s))
+  ));
+  y = V::mul(y, V::sub(V::splat(1.5f), V::mul(half, V::mul(y, y))));
+  y = V::mul(y, V::sub(V::splat(1.5f), V::mul(half, V::mul(y, y))));
+  return V::select(
+      V::less(s, V::splat(FLT_MIN)),
+      V::splat(0.0f),
+      V::mul(s, y)
+  );
+}
+
+// Runs op over [0, count) in native_ops-wide blocks, then the remainder one
+// element at a time with scalar_ops.
+template<typename Op>
+void for_each_lane_block(std::size_t count, Op op) {
+  using native = simd::native_ops;
+  std::size_t i = 0;
+  for (; i + native::width <= count; i += native::width) {
+    op.template operator()<native>(i);
+  }
+  for (; i < count; ++i) {
+    op.template operator()<simd::scalar_ops>(i);
+  }
+}
+
+} // namespace detail
+
+// Batch versions of sincos, fast_atan2 and fast_sqrt for host-side bulk work
+// -- offline signal processing, simulation, many drive axes at once. The
+// lanes are SSE2 or AVX2 on x86 hosts, depending on the target the code is
+// compiled for (-mavx2), and plain scalar code elsewhere. Accuracy matches
+// the scalar functions; results may differ from them in the last bit, as the
+// compiler may fuse multiply-adds differently. Outputs may alias inputs
+// element for element.
+
+// out[i] = sin(x[i]); any finite x[i] with |x[i]| < 1e10, as turns::from_rad.
+inline void sin_batch(std::span<float const> x, std::span<float> out) {
+  ASSUME(out.size() >= x.size());
+  detail::for_each_lane_block(x.size(), [&]<typename V>(std::size_t i) {
+    typename V::f32 s, c;
+    detail::sincos_lanes<V>(V::load(&x[i]), s, c);
+    V::store(&out[i], s);
+  });
+}
+
+// sin_out[i] = sin(x[i]), cos_out[i] = cos(x[i]); |x[i]| < 1e10, as sin_batch.
+inline void sincos_batch(
+    std::span<float const> x,
+    std::span<float> sin_out,
+    std::span<float> cos_out
+) {
+  ASSUME(sin_out.size() >= x.size());
+  ASSUME(cos_out.size() >= x.size());
+  detail::for_each_lane_block(x.size(), [&]<typename V>(std::size_t i) {
+    typename V::f32 s, c;
+    detail::sincos_lanes<V>(V::load(&x[i]), s, c);
+    V::store(&sin_out[i], s);
+    V::store(&cos_out[i], c);
+  });
+}
+
+// out[i] = atan2(y[i], x[i]), as fast_atan2.
+inline void atan2_batch(
+    std::span<float const> y,
+    std::span<float const> x,
+    std::span<float> out
+) {
+  ASSUME(x.size() == y.size());
+  ASSUME(out.size() >= y.size());
+  detail::for_each_lane_block(y.size(), [&]<typename V>(std::size_t i) {
+    V::store(
+        &out[i],
+        detail::atan2_lanes<V>(V::load(&y[i]), V::load(&x[i]))
+    );
+  });
+}
+
+// out[i] = sqrt(a[i]^2 + b[i]^2).
+inline void magnitude_batch(
+    std::span<float const> a,
+    std::span<float const> b,
+    std::span<float> out
+) {
+  ASSUME(a.size() == b.size());
+  ASSUME(out.size() >= a.size());
+  detail::for_each_lane_block(a.size(), [&]<typename V>(std::size_t i) {
+    V::store(
+        &out[i],
+        detail::magnitude_lanes<V>(V::load(&a[i]), V::load(&b[i]))
+    );
+  });
+}
+
+} // namespace emb
@@ -0,0 +1,346 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace emb {
+namespace detail {
+namespace simd {
+
+// Lane backends for the batch math kernels. Each is a set of static
+// operations over one register of float lanes (f32) and of 32-bit integer
+// lanes (i32); a mask is an i32 with every bit of a lane set or clear. The
+// kernels in math/batch.hpp are written once against this interface.
+
+struct scalar_ops {
+  static constexpr std::size_t width = 1;
+  using f32 = float;
+  using i32 = std::uint32_t;
+
+  static f32 load(float const* p) {
+    return *p;
+  }
+
+  static void store(float* p, f32 v) {
+    *p = v;
+  }
+
+  static f32 splat(float v) {
+    return v;
+  }
+
+  static i32 splat_i(std::uint32_t v) {
+    return v;
+  }
+
+  static f32 add(f32 a, f32 b) {
+    return a + b;
+  }
+
+  static f32 sub(f32 a, f32 b) {
+    return a - b;
+  }
+
+  static f32 mul(f32 a, f32 b) {
+    return a * b;
+  }
+
+  static f32 div(f32 a, f32 b) {
+    return a / b;
+  }
+
+  static f32 min(f32 a, f32 b) {
+    return a < b ? a : b;
+  }
+
+  static f32 max(f32 a, f32 b) {
+    return a > b ? a : b;
+  }
+
+  // Round to nearest (ties away from zero, where the vector backends round
+  // to even; the kernels do not depend on ties), as two's complement bits.
+  static i32 round_to_int(f32 v) {
+    return static_cast<i32>(
+        static_cast<std::int32_t>(v < 0.0f ? v - 0.5f : v + 0.5f)
+    );
+  }
+
+  // Signed conversion.
+  static f32 to_float(i32 v) {
+    return static_cast<float>(static_cast<std::int32_t>(v));
+  }
+
+  static i32 as_int(f32 v) {
+    return std::bit_cast<i32>(v);
+  }
+
+  static f32 as_float(i32 v) {
+    return std::bit_cast<f32>(v);
+  }
+
+  static i32 iand(i32 a, i32 b) {
+    return a & b;
+  }
+
+  static i32 ixor(i32 a, i32 b) {
+    return a ^ b;
+  }
+
+  static i32 isub(i32 a, i32 b) {
+    return a - b;
+  }
+
+  template<int N>
+  static i32 shr(i32 v) {
+    return v >> N;
+  }
+
+  template<int N>
+  static i32 shl(i32 v) {
+    return v << N;
+  }
+
+  static i32 less(f32 a, f32 b) {
+    return a < b ? ~i32(0) : 0;
+  }
+
+  static i32 greater(f32 a, f32 b) {
+    return a > b ? ~i32(0) : 0;
+  }
+
+  // Lanes of a where mask is set, of b elsewhere.
+  static f32 select(i32 mask, f32 a, f32 b) {
+    return mask ? a : b;
+  }
+
+  static f32 gather(float const* table, i32 idx) {
+    return table[idx];
+  }
+};
+
+#if defined(__SSE2__)
+struct sse2_ops {
+  static constexpr std::size_t width = 4;
+  using f32 = __m128;
+  using i32 = __m128i;
+
+  static f32 load(float const* p) {
+    return _mm_loadu_ps(p);
+  }
+
+  static void store(float* p, f32 v) {
+    _mm_storeu_ps(p, v);
+  }
+
+  static f32 splat(float v) {
+    return _mm_set1_ps(v);
+  }
+
+  static i32 splat_i(std::uint32_t v) {
+    return _mm_set1_epi32(static_cast<int>(v));
+  }
+
+  static f32 add(f32 a, f32 b) {
+    return _mm_add_ps(a, b);
+  }
+
+  static f32 sub(f32 a, f32 b) {
+    return _mm_sub_ps(a, b);
+  }
+
+  static f32 mul(f32 a, f32 b) {
+    return _mm_mul_ps(a, b);
+  }
+
+  static f32 div(f32 a, f32 b) {
+    return _mm_div_ps(a, b);
+  }
+
+  static f32 min(f32 a, f32 b) {
+    return _mm_min_ps(a, b);
+  }
+
+  static f32 max(f32 a, f32 b) {
+    return _mm_max_ps(a, b);
+  }
+
+  static i32 round_to_int(f32 v) {
+    return _mm_cvtps_epi32(v);
+  }
+
+  static f32 to_float(i32 v) {
+    return _mm_cvtepi32_ps(v);
+  }
+
+  static i32 as_int(f32 v) {
+    return _mm_castps_si128(v);
+  }
+
+  static f32 as_float(i32 v) {
+    return _mm_castsi128_ps(v);
+  }
+
+  static i32 iand(i32 a, i32 b) {
+    return _mm_and_si128(a, b);
+  }
+
+  static i32 ixor(i32 a, i32 b) {
+    return _mm_xor_si128(a, b);
+  }
+
+  static i32 isub(i32 a, i32 b) {
+    return _mm_sub_epi32(a, b);
+  }
+
+  template<int N>
+  static i32 shr(i32 v) {
+    return _mm_srli_epi32(v, N);
+  }
+
+  template<int N>
+  static i32 shl(i32 v) {
+    return _mm_slli_epi32(v, N);
+  }
+
+  static i32 less(f32 a, f32 b) {
+    return as_int(_mm_cmplt_ps(a, b));
+  }
+
+  static i32 greater(f32 a, f32 b) {
+    return as_int(_mm_cmpgt_ps(a, b));
+  }
+
+  static f32 select(i32 mask, f32 a, f32 b) {
+    f32 const m = as_float(mask);
+    return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+  }
+
+  // SSE2 has no gather; four scalar loads.
+  static f32 gather(float const* table, i32 idx) {
+    alignas(16) std::uint32_t i[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(i), idx);
+    return _mm_setr_ps(table[i[0]], table[i[1]], table[i[2]], table[i[3]]);
+  }
+};
+#endif
+
+#if defined(__AVX2__)
+struct avx2_ops {
+  static constexpr std::size_t width = 8;
+  using f32 = __m256;
+  using i32 = __m256i;
+
+  static f32 load(float const* p) {
+    return _mm256_loadu_ps(p);
+  }
+
+  static void store(float* p, f32 v) {
+    _mm256_storeu_ps(p, v);
+  }
+
+  static f32 splat(float v) {
+    return _mm256_set1_ps(v);
+  }
+
+  static i32 splat_i(std::uint32_t v) {
+    return _mm256_set1_epi32(static_cast<int>(v));
+  }
+
+  static f32 add(f32 a, f32 b) {
+    return _mm256_add_ps(a, b);
+  }
+
+  static f32 sub(f32 a, f32 b) {
+    return _mm256_sub_ps(a, b);
+  }
+
+  static f32 mul(f32 a, f32 b) {
+    return _mm256_mul_ps(a, b);
+  }
+
+  static f32 div(f32 a, f32 b) {
+    return _mm256_div_ps(a, b);
+  }
+
+  static f32 min(f32 a, f32 b) {
+    return _mm256_min_ps(a, b);
+  }
+
+  static f32 max(f32 a, f32 b) {
+    return _mm256_max_ps(a, b);
+  }
+
+  static i32 round_to_int(f32 v) {
+    return _mm256_cvtps_epi32(v);
+  }
+
+  static f32 to_float(i32 v) {
+    return _mm256_cvtepi32_ps(v);
+  }
+
+  static i32 as_int(f32 v) {
+    return _mm256_castps_si256(v);
+  }
+
+  static f32 as_float(i32 v) {
+    return _mm256_castsi256_ps(v);
+  }
+
+  static i32 iand(i32 a, i32 b) {
+    return _mm256_and_si256(a, b);
+  }
+
+  static i32 ixor(i32 a, i32 b) {
+    return _mm256_xor_si256(a, b);
+  }
+
+  static i32 isub(i32 a, i32 b) {
+    return _mm256_sub_epi32(a, b);
+  }
+
+  template<int N>
+  static i32 shr(i32 v) {
+    return _mm256_srli_epi32(v, N);
+  }
+
+  template<int N>
+  static i32 shl(i32 v) {
+    return _mm256_slli_epi32(v, N);
+  }
+
+  static i32 less(f32 a, f32 b) {
+    return as_int(_mm256_cmp_ps(a, b, _CMP_LT_OQ));
+  }
+
+  static i32 greater(f32 a, f32 b) {
+    return as_int(_mm256_cmp_ps(a, b, _CMP_GT_OQ));
+  }
+
+  static f32 select(i32 mask, f32 a, f32 b) {
+    return _mm256_blendv_ps(b, a, as_float(mask));
+  }
+
+  static f32 gather(float const* table, i32 idx) {
+    return _mm256_i32gather_ps(table, idx, 4);
+  }
+};
+#endif
+
+// Widest backend the target was compiled for; chosen at compile time, so a
+// binary built for plain x86-64 uses SSE2 even on an AVX2 host.
+#if defined(__AVX2__)
+using native_ops = avx2_ops;
+#elif defined(__SSE2__)
+using native_ops = sse2_ops;
+#else
+using native_ops = scalar_ops;
+#endif
+
+} // namespace simd
+} // namespace detail
+} // namespace emb
@@ -1,143 +1,187 @@
 #pragma once
 
+#include <emb/math/turns.hpp>
+
 #include <array>
+#include <bit>
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <numbers>
 
 namespace emb {
 
+struct sincos_pair {
+  float sin;
+  float cos;
+};
+
+namespace detail {
+
+// sin(x) for x in [0, pi/2] by its Taylor series in double precision; for
+// table generation only.
+constexpr double taylor_sin(double x) {
+  double const x2 = x * x;
+  double term = x;
+  double sum = x;
+  for (int n = 1; n < 15; ++n) {
+    term *= -x2 / ((2.0 * n) * (2.0 * n + 1.0));
+    sum += term;
+  }
+  return sum;
+}
+
+template<typename T>
+concept sin_table_element = std::same_as<T, float>
+                         || std::same_as<T, std::int16_t>
+                         || std::same_as<T, std::int32_t>;
+
+// Full scale of a Q15/Q31 entry; 1.0 itself saturates to the largest code.
+template<sin_table_element T>
+inline constexpr double sin_table_scale =
+    std::same_as<T, float> ? 1.0
+                           : double(std::uint64_t(1) << (sizeof(T) * 8 - 1));
+
+template<sin_table_element T>
+constexpr float sin_table_value(T v) {
+  constexpr float step = static_cast<float>(1.0 / sin_table_scale<T>);
+  if constexpr (std::same_as<T, float>) {
+    return v;
+  } else {
+    return static_cast<float>(v) * step;
+  }
+}
+
+} // namespace detail
+
+// Quarter-wave sine table of Steps steps: entry k is sin(k/Steps * pi/2),
+// k = 0..Steps, and entry Steps - k the matching cosine. Generated at compile
+// time for any power-of-two Steps, as float or as Q15 (int16_t) / Q31
+// (int32_t) fractions -- half the flash of float for Q15 at 3e-5 resolution.
+template<detail::sin_table_element T, std::size_t Steps>
+  requires(std::has_single_bit(Steps) && Steps <= (1u << 20))
+inline constexpr auto sin_table = [] {
+  std::array<T, Steps + 1> table{};
+  for (std::size_t k = 0; k <= Steps; ++k) {
+    double const v = detail::taylor_sin(
+        static_cast<double>(k) * (std::numbers::pi / (2.0 * Steps))
+    );
+    if constexpr (std::same_as<T, float>) {
+      table[k] = static_cast<float>(v);
+    } else {
+      double const code = v * detail::sin_table_scale<T> + 0.5;
+      table[k] = code >= double(std::numeric_limits<T>::max())
+                   ? std::numeric_limits<T>::max()
+                   : static_cast<T>(code);
+    }
+  }
+  return table;
+}();
+
 namespace detail {
 
-inline constexpr std::array<float, 129> sincos_lookup_table{
-    0.0f,
-    0.012271538285719931f,
-    0.024541228522912288f,
-    0.036807222941358832f,
-    0.049067674327418015f,
-    0.061320736302208578f,
-    0.073564563599667426f,
-    0.085797312344439894f,
-    0.098017140329560604f,
-    0.11022220729388306f,
-    0.1224106751992162f,
-    0.13458070850712617f,
-    0.14673047445536175f,
-    0.15885814333386145f,
-    0.17096188876030122f,
-    0.18303988795514095f,
-    0.19509032201612825f,
-    0.20711137619221856f,
-    0.2191012401568698f,
-    0.23105810828067111f,
-    0.24298017990326387f,
-    0.25486565960451457f,
-    0.26671275747489837f,
-    0.27851968938505306f,
-    0.29028467725446233f,
-    0.30200594931922808f,
-    0.31368174039889152f,
-    0.32531029216226293f,
-    0.33688985339222005f,
-    0.34841868024943456f,
-    0.35989503653498811f,
-    0.37131719395183754f,
-    0.38268343236508978f,
-    0.3939920400610481f,
-    0.40524131400498986f,
-    0.41642956009763715f,
-    0.42755509343028208f,
-    0.43861623853852766f,
-    0.44961132965460654f,
-    0.46053871095824001f,
-    0.47139673682599764f,
-    0.48218377207912272f,
-    0.49289819222978404f,
-    0.50353838372571758f,
-    0.51410274419322166f,
-    0.52458968267846895f,
-    0.53499761988709715f,
-    0.54532498842204646f,
-    0.55557023301960218f,
-    0.56573181078361312f,
-    0.57580819141784534f,
-    0.58579785745643886f,
-    0.59569930449243336f,
-    0.60551104140432555f,
-    0.61523159058062682f,
-    0.62485948814238634f,
-    0.63439328416364549f,
-    0.64383154288979139f,
-    0.65317284295377676f,
-    0.66241577759017178f,
-    0.67155895484701833f,
-    0.68060099779545302f,
-    0.68954054473706683f,
-    0.69837624940897292f,
-    0.70710678118654746f,
-    0.71573082528381859f,
-    0.72424708295146689f,
-    0.73265427167241282f,
-    0.74095112535495911f,
-    0.74913639452345926f,
-    0.75720884650648446f,
-    0.76516726562245896f,
-    0.77301045336273699f,
-    0.78073722857209438f,
-    0.78834642762660623f,
-    0.79583690460888346f,
-    0.80320753148064483f,
-    0.81045719825259477f,
-    0.81758481315158371f,
-    0.82458930278502529f,
-    0.83146961230254524f,
-    0.83822470555483797f,
-    0.84485356524970712f,
-    0.8513551931052652f,
-    0.85772861000027212f,
-    0.8639728561215867f,
-    0.87008699110871135f,
-    0.8760700941954066f,
-    0.88192126434835494f,
-    0.88763962040285393f,
-    0.89322430119551532f,
-    0.89867446569395382f,
-    0.90398929312344334f,
-    0.90916798309052238f,
-    0.91420975570353069f,
-    0.91911385169005777f,
-    0.92387953251128674f,
-    0.92850608047321548f,
-    0.93299279883473885f,
-    0.93733901191257485f,
-    0.94154406518302081f,
-    0.94560732538052128f,
-    0.94952818059303667f,
-    0.95330604035419375f,
-    0.95694033573220894f,
-    0.96043051941556579f,
-    0.96377606579543984f,
-    0.96697647104485207f,
-    0.97003125319454397f,
-    0.97293995220556007f,
-    0.97570213003852857f,
-    0.97831737071962765f,
-    0.98078528040323043f,
-    0.98310548743121629f,
-    0.98527764238894122f,
-    0.98730141815785843f,
-    0.98917650996478101f,
-    0.99090263542778001f,
-    0.99247953459870997f,
-    0.99390697000235606f,
-    0.99518472667219682f,
-    0.996312612182778f,
-    0.99729045667869021f,
-    0.99811811290014918f,
-    0.99879545620517241f,
-    0.99932238458834954f,
-    0.99969881869620425f,
-    0.9999247018391445f,
-    1.0f};
+// sin and cos of the offset z * h (z in [0, 1)) into one step h = pi/2 / Steps
+// of a sin_table, as odd and even Taylor polynomials in z; combined with the
+// table entries by the angle addition formulas.
+template<std::size_t Steps = 128>
+constexpr sincos_pair step_sincos(float z) {
+  constexpr double h = std::numbers::pi / (2.0 * Steps);
+  constexpr float s1 = static_cast<float>(h);
+  constexpr float s3 = static_cast<float>(-h * h * h / 6.0);
+  constexpr float s5 = static_cast<float>(h * h * h * h * h / 120.0);
+  constexpr float c2 = static_cast<float>(h * h / 2.0);
+  constexpr float c4 = static_cast<float>(-h * h * h * h / 24.0);
+  constexpr float c6 = static_cast<float>(h * h * h * h * h * h / 720.0);
+  float zz = z * z;
+  float ss = z * (s1 + zz * (s3 + s5 * zz));
+  float cc = 1.0f - zz * (c2 + zz * (c4 + c6 * zz));
+  return {ss, cc};
+}
+
+// sin/cos of quadrant * pi/2 + a from those of a.
+constexpr sincos_pair rotate_quadrant(sincos_pair v, std::uint32_t quadrant) {
+  switch (quadrant & 3) {
+  case 0:
+    return v;
+  case 1:
+    return {v.cos, -v.sin};
+  case 2:
+    return {-v.sin, -v.cos};
+  default:
+    return {-v.cos, v.sin};
+  }
+}
+
+// Odd minimax polynomial for sin(a), a in [0, pi/2]; max error 1.5e-6.
+constexpr float quarter_wave_sin(float a) {
+  float const a2 = a * a;
+  return a * (0.99999961852f
+      + a2 * (-0.16665846902f
+      + a2 * (0.0083139586816f
+      + a2 * -0.00018523220172f)));
+}
+
+// atan(x) for x in [0, 1] in double precision by Euler's series, whose
+// terms shrink at least by half; for table generation only.
+constexpr double euler_atan(double x) {
+  double const y = x * x / (1.0 + x * x);
+  double term = x / (1.0 + x * x);
+  double sum = term;
+  for (int n = 0; n < 60; ++n) {
+    term *= y * (2.0 * n + 2.0) / (2.0 * n + 3.0);
+    sum += term;
+  }
+  return sum;
+}
+
+// atan(a0) and its slope 1 / (1 + a0^2) at a0 = k/128, k = 0..128.
+struct atan_table_entry {
+  float value;
+  float slope;
+};
+
+inline constexpr auto atan_lookup_table = [] {
+  std::array<atan_table_entry, 129> table{};
+  for (std::size_t k = 0; k < table.size(); ++k) {
+    double const a0 = static_cast<double>(k) / 128.0;
+    table[k] = {
+        static_cast<float>(euler_atan(a0)),
+        static_cast<float>(1.0 / (1.0 + a0 * a0))
+    };
+  }
+  return table;
+}();
+
+// Reduces atan2(y, x) to atan(a), a in [0, 1], evaluated by atan01, and
+// maps the result back to (-pi, pi].
+template<typename Atan01>
+constexpr float atan2_by_octant(float y, float x, Atan01 atan01) {
+  constexpr float pi = std::numbers::pi_v<float>;
+  constexpr float half_pi = pi / 2.0f;
+
+  if (x == 0.0f && y == 0.0f) {
+    return 0.0f;
+  }
+
+  float ax = x < 0.0f ? -x : x;
+  float ay = y < 0.0f ? -y : y;
+
+  bool swap = ay > ax;
+  float r = atan01(swap ? ax / ay : ay / ax);
+
+  if (swap) {
+    r = half_pi - r;
+  }
+  if (x < 0.0f) {
+    r = pi - r;
+  }
+  if (y < 0.0f) {
+    r = -r;
+  }
+
+  return r;
+}
 
 } // namespace detail
 
@@ -160,16 +204,10 @@ constexpr float lookup_sin(float x) {
   std::size_t zf = static_cast<std::size_t>(z);
   z -= static_cast<float>(zf);
 
-  float sint = detail::sincos_lookup_table[zf];
-  float cost = detail::sincos_lookup_table[128 - zf];
+  float sint = sin_table<float, 128>[zf];
+  float cost = sin_table<float, 128>[128 - zf];
 
-  float zz = z * z;
-  float ss =
-      z * (0.012271846303085128928f +
-           zz * (-3.0801968454884792651e-7f + 2.3193461291439683491e-12f * zz));
-  float cc = 1.0f - zz * (0.000075299105843272081f +
-                          zz * (-9.449925567834354484e-10f +
-                                4.7437807891647010749e-15f * zz));
+  auto const [ss, cc] = detail::step_sincos(z);
 
   float sin_v = (sign ^ per) ? -sint * cc - cost * ss : sint * cc + cost * ss;
   return sin_v;
@@ -179,42 +217,126 @@ constexpr float lookup_cos(float x) {
   return lookup_sin(x + std::numbers::pi_v<float> / 2.0f);
 }
 
-constexpr float fast_atan2(float y, float x) {
-  constexpr float pi = std::numbers::pi_v<float>;
-  constexpr float half_pi = pi / 2.0f;
+// How table_sincos fills in between table entries.
+enum class table_interp {
+  nearest,   // closest entry, no arithmetic
+  linear,    // straight line between neighbouring entries
+  angle_sum  // exact step offset by the angle addition formulas
+};
 
-  if (x == 0.0f && y == 0.0f) {
-    return 0.0f;
+// sin and cos together from one lookup in sin_table<T, Steps>. The top two
+// bits of the angle select the quadrant, the next log2(Steps) the table
+// entry and the rest the offset into the step, so there is no division and
+// no range reduction. Max abs error of float and Q31 tables (a Q15 table
+// bottoms out at its 3.05e-5 resolution):
+//
+//   Steps    bytes    nearest    linear     angle_sum
+//      64      260    1.2e-2     7.5e-5     1.2e-7
+//     128      516    6.1e-3     1.9e-5     1.2e-7
+//     256     1028    3.1e-3     4.8e-6     1.1e-7
+//     512     2052    1.5e-3     1.2e-6     1.1e-7
+//    1024     4100    7.7e-4     3.5e-7     1.1e-7
+//    2048     8196    3.8e-4     1.3e-7     1.1e-7
+//    4096    16388    1.9e-4     7.7e-8     1.0e-7
+//
+// From 2048 steps up, linear matches angle_sum at about two thirds of its
+// time on an x86 host; bench/sin_table_bench prints these figures with the
+// time per call for each element type.
+template<
+    detail::sin_table_element T,
+    std::size_t Steps,
+    table_interp Interp = table_interp::angle_sum>
+constexpr sincos_pair table_sincos(turns angle) {
+  constexpr auto const& table = sin_table<T, Steps>;
+  constexpr int frac_bits = 30 - std::countr_zero(Steps);
+  constexpr std::uint32_t frac_mask = (std::uint32_t(1) << frac_bits) - 1;
+
+  std::uint32_t const raw = angle.raw();
+  std::size_t idx = (raw >> frac_bits) & (Steps - 1);
+  std::uint32_t const frac = raw & frac_mask;
+
+  sincos_pair v;
+  if constexpr (Interp == table_interp::nearest) {
+    idx += frac >> (frac_bits - 1);
+    v = {
+        detail::sin_table_value(table[idx]),
+        detail::sin_table_value(table[Steps - idx])
+    };
+  } else {
+    constexpr float frac_scale = 1.0f / static_cast<float>(frac_mask + 1.0);
+    float const z = static_cast<float>(frac) * frac_scale;
+    float const sint = detail::sin_table_value(table[idx]);
+    float const cost = detail::sin_table_value(table[Steps - idx]);
+    if constexpr (Interp == table_interp::linear) {
+      float const sin_next = detail::sin_table_value(table[idx + 1]);
+      float const cos_next = detail::sin_table_value(table[Steps - idx - 1]);
+      v = {sint + z * (sin_next - sint), cost + z * (cos_next - cost)};
+    } else {
+      auto const [ss, cc] = detail::step_sincos<Steps>(z);
+      v = {sint * cc + cost * ss, cost * cc - sint * ss};
+    }
   }
+  return detail::rotate_quadrant(v, raw >> 30);
+}
 
-  float ax = x < 0.0f ? -x : x;
-  float ay = y < 0.0f ? -y : y;
+// sin and cos together from the default 128-step float table. Same accuracy
+// as lookup_sin.
+constexpr sincos_pair sincos(turns angle) {
+  return table_sincos<float, 128>(angle);
+}
 
-  // reduce to atan(a) where a in [0, 1]
-  bool swap = ay > ax;
-  float a = swap ? ax / ay : ay / ax;
-
-  // minimax polynomial for atan(a) on [0, 1], max error ~1.5e-5
-  float a2 = a * a;
-  float r = a * (1.0f
-      + a2 * (-0.3333314528f
-      + a2 * (0.1999355085f
-      + a2 * (-0.1420889944f
-      + a2 * (0.1065626393f
-      + a2 * (-0.0752896400f
-      + a2 * 0.0429096138f))))));
+constexpr sincos_pair sincos(float x) {
+  return sincos(turns::from_rad(x));
+}
 
-  if (swap) {
-    r = half_pi - r;
-  }
-  if (x < 0.0f) {
-    r = pi - r;
-  }
-  if (y < 0.0f) {
-    r = -r;
-  }
+// Table-free sin/cos: the quadrant comes from the turns angle, the rest from
+// a degree-7 minimax polynomial; max error 1.5e-6.
+constexpr sincos_pair poly_sincos(turns angle) {
+  constexpr float half_pi = std::numbers::pi_v<float> / 2.0f;
+  std::uint32_t const raw = angle.raw();
+  float const a =
+      static_cast<float>(raw & 0x3fff'ffff) * (half_pi / 1073741824.0f);
+  return detail::rotate_quadrant(
+      {detail::quarter_wave_sin(a), detail::quarter_wave_sin(half_pi - a)},
+      raw >> 30
+  );
+}
 
-  return r;
+constexpr float poly_sin(float x) {
+  return poly_sincos(turns::from_rad(x)).sin;
+}
+
+constexpr float poly_cos(float x) {
+  return poly_sincos(turns::from_rad(x)).cos;
+}
+
+constexpr float fast_atan2(float y, float x) {
+  return detail::atan2_by_octant(y, x, [](float a) {
+    // minimax polynomial for atan(a) on [0, 1], max error ~2.2e-6
+    float a2 = a * a;
+    return a * (0.99999997596f
+        + a2 * (-0.33332251836f
+        + a2 * (0.19957728206f
+        + a2 * (-0.13833401501f
+        + a2 * (0.09070502172f
+        + a2 * (-0.04309138166f
+        + a2 * 0.00986379869f))))));
+  });
+}
+
+// atan2 from a 129-entry atan table on [0, 1] with a third-order Taylor
+// correction: with s = 1 / (1 + a0^2),
+//   atan(a0 + d) = atan(a0) + ds - a0 (ds)^2 + (a0^2 - 1/3) (ds)^3.
+constexpr float lookup_atan2(float y, float x) {
+  return detail::atan2_by_octant(y, x, [](float a) {
+    float z = a * 128.0f;
+    std::size_t const k = static_cast<std::size_t>(z);
+    float const d = (z - static_cast<float>(k)) * (1.0f / 128.0f);
+    auto const e = detail::atan_lookup_table[k];
+    float const a0 = static_cast<float>(k) * (1.0f / 128.0f);
+    float const ds = d * e.slope;
+    return e.value + ds * (1.0f + ds * (-a0 + ds * (a0 * a0 - 1.0f / 3.0f)));
+  });
 }
 
 } // namespace emb
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <numbers>
+
+namespace emb {
+
+// Angle as a binary fraction of a full turn: the 2^32 counts of a uint32_t
+// span [0, 2pi), so adding and subtracting angles wraps around the circle
+// for free -- no fmod, no norm2pi -- and a phase accumulator never loses
+// resolution however long it runs. The resolution is 2pi / 2^32 (1.5e-9 rad)
+// everywhere on the circle.
+class turns {
+  std::uint32_t v_ = 0;
+
+  static constexpr float counts_per_turn = 4294967296.0f;
+  static constexpr float counts_per_rad =
+      counts_per_turn / (2 * std::numbers::pi_v<float>);
+public:
+  constexpr turns() = default;
+
+  constexpr explicit turns(std::uint32_t raw) : v_(raw) {}
+
+  // Any finite angle with |rad| < 1e10, wrapped onto the circle.
+  static constexpr turns from_rad(float rad) {
+    return turns(static_cast<std::uint32_t>(
+        static_cast<std::int64_t>(rad * counts_per_rad)
+    ));
+  }
+
+  // Fraction of a full turn, e.g. freq * period for a per-update phase
+  // step; wrapped like from_rad.
+  static constexpr turns from_fraction(float fraction) {
+    return turns(static_cast<std::uint32_t>(
+        static_cast<std::int64_t>(fraction * counts_per_turn)
+    ));
+  }
+
+  constexpr std::uint32_t raw() const {
+    return v_;
+  }
+
+  // In [0, 2pi).
+  constexpr float to_rad() const {
+    // 24 significant bits keep the float strictly below 2pi.
+    return static_cast<float>(v_ >> 8) * (256.0f / counts_per_rad);
+  }
+
+  // In [-pi, pi).
+  constexpr float to_signed_rad() const {
+    return static_cast<float>(static_cast<std::int32_t>(v_) >> 8)
+         * (256.0f / counts_per_rad);
+  }
+
+  constexpr turns& operator+=(turns rhs) {
+    v_ += rhs.v_;
+    return *this;
+  }
+
+  constexpr turns& operator-=(turns rhs) {
+    v_ -= rhs.v_;
+    return *this;
+  }
+
+  friend constexpr turns operator+(turns lhs, turns rhs) {
+    return lhs += rhs;
+  }
+
+  friend constexpr turns operator-(turns lhs, turns rhs) {
+    return lhs -= rhs;
+  }
+
+  friend constexpr turns operator-(turns v) {
+    return turns(0u - v.v_);
+  }
+
+  friend constexpr bool operator==(turns, turns) = default;
+};
+
+} // namespace emb
@@ -3,6 +3,9 @@
 #include <emb/sensor/concepts.hpp>
 #include <emb/sensor/transform.hpp>
 #include <emb/sensor/streaming_prefilter.hpp>
+#include <emb/sensor/cic_prefilter.hpp>
 #include <emb/sensor/singlephase.hpp>
+#include <emb/sensor/buffered_stats.hpp>
 #include <emb/sensor/buffered.hpp>
 #include <emb/sensor/polyphase.hpp>
+#include <emb/sensor/soa_polyphase.hpp>
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <emb/sensor/buffered_stats.hpp>
 #include <emb/sensor/concepts.hpp>
 #include <emb/sensor/singlephase.hpp>
 
 #include <concepts>
 #include <cstddef>
+#include <limits>
+#include <span>
 #include <utility>
 
 namespace emb::sensor {
@@ -15,10 +18,15 @@ namespace emb::sensor {
 // The core is any some_sensor_core -- singlephase for a single channel,
 // polyphase for an aligned N-phase frame -- and the queue's element type must
 // match the core's sample_type (a scalar code, or a whole frame).
-template<typename Queue, typename Core>
+//
+// Stats selects the instrumentation: no_buffered_stats (default) compiles it
+// out, buffered_stats counts drops, the queue high-water mark and the samples
+// handled per process() call; read it through stats().
+template<typename Queue, typename Core, typename Stats = no_buffered_stats>
   requires some_spsc_queue<Queue>
         && some_sensor_core<Core>
         && std::same_as<typename Queue::value_type, typename Core::sample_type>
+        && (!Stats::enabled || requires(Queue const& q) { q.size(); })
 class buffered {
 public:
   using core_type = Core;
@@ -28,6 +36,7 @@ public:
 private:
   Queue queue_;
   Core core_;
+  [[no_unique_address]] Stats stats_;
 public:
   template<typename... Args>
     requires std::constructible_from<Core, Args...>
@@ -37,6 +46,10 @@ public:
     return core_;
   }
 
+  Stats const& stats() const {
+    return stats_;
+  }
+
   // Convenience forwarder for singlephase cores; absent for polyphase,
   // which is read through values() / value(phase) below.
   value_type value() const
@@ -57,13 +70,52 @@ public:
 
   // Producer-side (ISR). On overflow the newest sample is dropped.
   void submit(sample_type sample) {
-    auto _ = queue_.try_push(std::move(sample));
+    if constexpr (Stats::enabled) {
+      if (queue_.try_push(std::move(sample))) {
+        stats_.on_push(queue_.size());
+      } else {
+        stats_.on_drop();
+      }
+    } else {
+      auto _ = queue_.try_push(std::move(sample));
+    }
   }
 
-  // Consumer-side (main loop). Drains the queue through the core pipeline.
-  void process() {
-    while (auto const raw = queue_.try_pop()) {
-      core_.submit(*raw);
+  // Consumer-side (main loop). Drains the queue through the core pipeline
+  // and returns the number of samples processed. budget caps that number, so
+  // a call has a bounded worst-case duration; the rest waits for the next
+  // call. A bulk queue hands its contents over as spans -- one acquire and one
+  // release per call -- straight into a block-submitting core.
+  std::size_t
+  process(std::size_t budget = std::numeric_limits<std::size_t>::max()) {
+    std::size_t const count = drain(budget);
+    stats_.on_process(count);
+    return count;
+  }
+private:
+  std::size_t drain(std::size_t budget) {
+    if constexpr (some_bulk_spsc_queue<Queue>) {
+      return queue_.drain(
+          [this](std::span<sample_type const> samples) {
+            if constexpr (some_block_sensor_core<Core>) {
+              core_.submit(samples);
+            } else {
+              for (auto const& sample : samples) {
+                core_.submit(sample);
+              }
+            }
+          },
+          budget
+      );
+    } else {
+      std::size_t count = 0;
+      while (count < budget) {
+        auto const raw = queue_.try_pop();
+        if (!raw) break;
+        core_.submit(*raw);
+        ++count;
+      }
+      return count;
     }
   }
 };
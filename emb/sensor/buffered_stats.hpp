@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace emb::sensor {
+
+// Instrumentation policies for buffered. buffered reports three events:
+//   on_push(depth)     producer side, after a successful push; depth is the
+//                      queue size including the new sample
+//   on_drop()          producer side, when a sample is lost to overflow
+//   on_process(count)  consumer side, at the end of every process() call
+
+// Default policy: every hook is empty and the object is stored with
+// [[no_unique_address]], so an uninstrumented buffered costs nothing.
+struct no_buffered_stats {
+  static constexpr bool enabled = false;
+
+  constexpr void on_push(std::size_t) {}
+  constexpr void on_drop() {}
+  constexpr void on_process(std::size_t) {}
+};
+
+// Counting policy. Each counter has exactly one writer (dropped and high-water
+// the producer, processed the consumer), so updates are a relaxed load/store
+// rather than a read-modify-write -- no LDREX/STREX loop in the ISR. Readers
+// in any context get a relaxed, lock-free snapshot of each counter; counters
+// wrap at the width of std::atomic_unsigned_lock_free.
+class buffered_stats {
+public:
+  static constexpr bool enabled = true;
+  using counter_type = std::atomic_unsigned_lock_free::value_type;
+private:
+  std::atomic_unsigned_lock_free dropped_ = 0;
+  std::atomic_unsigned_lock_free high_water_ = 0;
+  std::atomic_unsigned_lock_free last_processed_ = 0;
+  std::atomic_unsigned_lock_free max_processed_ = 0;
+public:
+  buffered_stats() = default;
+  buffered_stats(buffered_stats const&) = delete;
+  buffered_stats& operator=(buffered_stats const&) = delete;
+
+  // Samples lost to queue overflow since construction.
+  counter_type dropped() const {
+    return dropped_.load(std::memory_order::relaxed);
+  }
+
+  // Deepest queue fill seen by the producer, in samples.
+  counter_type high_water() const {
+    return high_water_.load(std::memory_order::relaxed);
+  }
+
+  // Samples handled by the latest process() call, and the most in any call.
+  counter_type last_processed() const {
+    return last_processed_.load(std::memory_order::relaxed);
+  }
+
+  counter_type max_processed() const {
+    return max_processed_.load(std::memory_order::relaxed);
+  }
+
+  void on_push(std::size_t depth) {
+    auto const d = static_cast<counter_type>(depth);
+    if (d > high_water_.load(std::memory_order::relaxed)) {
+      high_water_.store(d, std::memory_order::relaxed);
+    }
+  }
+
+  void on_drop() {
+    dropped_.store(
+        dropped_.load(std::memory_order::relaxed) + 1,
+        std::memory_order::relaxed
+    );
+  }
+
+  void on_process(std::size_t count) {
+    auto const c = static_cast<counter_type>(count);
+    last_processed_.store(c, std::memory_order::relaxed);
+    if (c > max_processed_.load(std::memory_order::relaxed)) {
+      max_processed_.store(c, std::memory_order::relaxed);
+    }
+  }
+};
+
+} // namespace emb::sensor
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace emb::sensor {
+
+namespace detail {
+
+template<std::integral Code, std::size_t Factor, std::size_t Order>
+consteval std::size_t cic_register_bits() {
+  return std::numeric_limits<std::make_unsigned_t<Code>>::digits
+       + Order * std::bit_width(Factor - 1);
+}
+
+} // namespace detail
+
+// Q15 taps of the 3-tap compensator {-a, 1 + 2a, -a}, a = Order/24, that
+// flattens the second-order droop of an Order-stage CIC in the output band.
+// Taps sum to 1.0 (32768), so DC passes unchanged.
+template<std::size_t Order>
+consteval std::array<std::int32_t, 3> cic_compensator_taps() {
+  constexpr std::int32_t one = 1 << 15;
+  constexpr std::int32_t a = static_cast<std::int32_t>(
+      (static_cast<std::int64_t>(Order) * one + 12) / 24
+  );
+  return {-a, one + 2 * a, -a};
+}
+
+// Decimating block prefilter: reduces a burst of Factor oversampled codes to
+// one raw code through an Order-stage CIC (cascaded integrator-comb) decimator
+// and an optional Taps-long FIR compensator running at the output rate. This
+// is the native block (pack-in) counterpart of streaming_prefilter: its
+// sample_type is the whole burst, so a singlephase/polyphase core converts
+// and filters once per burst instead of once per ADC sample.
+//
+// The CIC runs in wrapping unsigned integer arithmetic wide enough for
+// bits(Code) + Order*log2(Factor) -- modular overflow inside the integrators
+// cancels in the combs -- and its gain Factor^Order is divided out (a shift
+// for power-of-two Factor). State carries across bursts; after a reset the
+// first Order + Taps outputs are start-up transient.
+template<
+    std::integral Code,
+    std::size_t Factor,
+    std::size_t Order = 2,
+    std::size_t Taps = 0>
+  requires(Factor > 1 && Order > 0)
+class cic_prefilter {
+  static constexpr std::size_t register_bits =
+      detail::cic_register_bits<Code, Factor, Order>();
+  static_assert(register_bits <= 64, "CIC register exceeds 64 bits");
+public:
+  using sample_type = std::array<Code, Factor>;
+  using value_type = Code;
+  using register_type = std::
+      conditional_t<(register_bits <= 32), std::uint32_t, std::uint64_t>;
+  using taps_type = std::array<std::int32_t, Taps>;
+
+  static constexpr std::size_t decimation_factor = Factor;
+  static constexpr std::size_t order = Order;
+  static constexpr std::size_t tap_count = Taps;
+private:
+  using signed_register_type = std::make_signed_t<register_type>;
+
+  static constexpr register_type gain = [] {
+    register_type g = 1;
+    for (std::size_t i = 0; i < Order; ++i) {
+      g *= static_cast<register_type>(Factor);
+    }
+    return g;
+  }();
+
+  std::array<register_type, Order> integrators_{};
+  std::array<register_type, Order> comb_delays_{};
+  taps_type taps_{};
+  std::array<std::int64_t, Taps> history_{};
+public:
+  constexpr cic_prefilter()
+    requires(Taps == 0)
+  = default;
+
+  // taps_q15: compensator taps in Q15, e.g. cic_compensator_taps<Order>().
+  constexpr explicit cic_prefilter(taps_type const& taps_q15)
+    requires(Taps > 0)
+      : taps_(taps_q15) {}
+
+  constexpr value_type operator()(sample_type const& burst) {
+    for (Code const code : burst) {
+      register_type x = static_cast<register_type>(code);
+      for (auto& acc : integrators_) {
+        acc += x;
+        x = acc;
+      }
+    }
+
+    register_type y = integrators_.back();
+    for (auto& delay : comb_delays_) {
+      register_type const diff = y - delay;
+      delay = y;
+      y = diff;
+    }
+
+    std::int64_t const reduced = normalize(y);
+    if constexpr (Taps == 0) {
+      return static_cast<value_type>(reduced);
+    } else {
+      std::shift_right(history_.begin(), history_.end(), 1);
+      history_[0] = reduced;
+      std::int64_t acc = 0;
+      for (std::size_t k = 0; k < Taps; ++k) {
+        acc += static_cast<std::int64_t>(taps_[k]) * history_[k];
+      }
+      acc = (acc + (std::int64_t{1} << 14)) >> 15;
+      return static_cast<value_type>(std::clamp<std::int64_t>(
+          acc,
+          std::numeric_limits<value_type>::min(),
+          std::numeric_limits<value_type>::max()
+      ));
+    }
+  }
+
+  constexpr void reset() {
+    integrators_.fill(0);
+    comb_delays_.fill(0);
+    history_.fill(0);
+  }
+private:
+  // Comb output (modulo 2^bits) back to the code range: signed codes are
+  // re-read as two's complement first, then the CIC gain is divided out.
+  static constexpr std::int64_t normalize(register_type y) {
+    if constexpr (std::is_signed_v<Code>) {
+      auto const v = static_cast<signed_register_type>(y);
+      if constexpr (std::has_single_bit(Factor)) {
+        return v >> std::countr_zero(gain);
+      } else {
+        return v / static_cast<signed_register_type>(gain);
+      }
+    } else {
+      if constexpr (std::has_single_bit(Factor)) {
+        return static_cast<std::int64_t>(y >> std::countr_zero(gain));
+      } else {
+        return static_cast<std::int64_t>(y / gain);
+      }
+    }
+  }
+};
+
+} // namespace emb::sensor
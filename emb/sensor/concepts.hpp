@@ -1,7 +1,9 @@
 #pragma once
 
 #include <concepts>
+#include <cstddef>
 #include <optional>
+#include <span>
 
 namespace emb::sensor {
 
@@ -12,6 +14,18 @@ concept some_spsc_queue = requires(Q q, typename Q::value_type v) {
   { q.try_pop() } -> std::same_as<std::optional<typename Q::value_type>>;
 };
 
+// An SPSC queue whose consumer can also take the head as contiguous spans:
+// drain(f, n) passes up to n elements to f in at most two spans and returns
+// how many it consumed.
+template<typename Q>
+concept some_bulk_spsc_queue = some_spsc_queue<Q> && requires(
+    Q q,
+    void (*consumer)(std::span<typename Q::value_type const>),
+    std::size_t max_count
+) {
+  { q.drain(consumer, max_count) } -> std::convertible_to<std::size_t>;
+};
+
 template<typename P>
 concept some_prefilter = requires(P p, typename P::sample_type const& s) {
   typename P::sample_type;
@@ -35,6 +49,19 @@ concept some_filter = requires(
   f.push(v);
 };
 
+// A filter that also accepts whole blocks: push(span) leaves the same state
+// as pushing each sample in order, push(span, span) additionally stores the
+// output after every sample. Sensors detect it to submit blocks in one call.
+template<typename F>
+concept some_block_filter = some_filter<F> && requires(
+    F f,
+    std::span<typename F::value_type const> in,
+    std::span<typename F::value_type> out
+) {
+  f.push(in);
+  f.push(in, out);
+};
+
 // A sensor core: it converts and filters submitted samples and exposes the
 // filtered result. sample_type is what a producer submits and what a buffered
 // queue stores -- one scalar code for singlephase, one aligned frame of codes
@@ -48,6 +75,16 @@ concept some_sensor_core = requires(C c, typename C::sample_type const& s) {
   c.submit(s);
 };
 
+// A sensor core that also takes a block of samples in one submit(span) call,
+// with the same effect as submitting them one by one.
+template<typename C>
+concept some_block_sensor_core = some_sensor_core<C> && requires(
+    C c,
+    std::span<typename C::sample_type const> samples
+) {
+  c.submit(samples);
+};
+
 // Phase-arity markers for metaprogramming. They partition sensor surfaces by
 // how the filtered result reads back: a polyphase surface exposes a frame-wide
 // values(), a singlephase surface a scalar value().
@@ -2,6 +2,10 @@
 
 #include <emb/sensor/concepts.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
 #include <utility>
 
 namespace emb::sensor {
@@ -22,6 +26,9 @@ public:
   using sample_type = typename Prefilter::sample_type;
   using raw_type = typename Prefilter::value_type;
   using value_type = typename Filter::value_type;
+
+  // Samples converted per step of a block submit (stack buffer length).
+  static constexpr std::size_t block_chunk = 32;
 private:
   Prefilter prefilter_;
   Converter converter_;
@@ -39,6 +46,27 @@ public:
   void submit(sample_type sample) {
     filter_.push(converter_(prefilter_(sample)));
   }
+
+  // Block submission, equivalent to submitting the samples one by one. For a
+  // some_block_filter the samples are converted chunk-wise into a stack
+  // buffer and each chunk goes through the filter's block push.
+  void submit(std::span<sample_type const> samples) {
+    if constexpr (some_block_filter<Filter>) {
+      std::array<value_type, block_chunk> converted;
+      while (!samples.empty()) {
+        std::size_t const n = std::min(samples.size(), block_chunk);
+        for (std::size_t i = 0; i < n; ++i) {
+          converted[i] = converter_(prefilter_(samples[i]));
+        }
+        filter_.push(std::span<value_type const>(converted.data(), n));
+        samples = samples.subspan(n);
+      }
+    } else {
+      for (auto const& sample : samples) {
+        submit(sample);
+      }
+    }
+  }
 };
 
 } // namespace emb::sensor
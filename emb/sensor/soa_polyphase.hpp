@@ -0,0 +1,95 @@
+#pragma once
+
+#include <emb/sensor/concepts.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+namespace emb::sensor {
+
+// A filter over whole frames: value_type is std::array<T, N>, one lane per
+// phase (e.g. polyphase_exponential_filter, polyphase_iir_sos_filter,
+// median_filter<std::array<T, N>, K>, passthrough_filter<std::array<T, N>>).
+template<typename F, std::size_t N>
+concept some_frame_filter =
+    some_filter<F>
+    && std::same_as<
+        typename F::value_type,
+        std::array<typename F::value_type::value_type, N>>;
+
+// Structure-of-arrays N-phase sensor core. Where polyphase keeps N complete
+// singlephase pipelines side by side (each phase's converter and filter state
+// interleaved), this core keeps the per-phase gains, offsets and the filter
+// state in contiguous per-field arrays and runs one loop over phases per
+// stage, which the compiler can vectorize.
+//
+// The conversion is fixed to per-phase affine calibration,
+//   value[p] = gain[p] * raw[p] + offset[p],
+// and there is no separate raw-domain prefilter: linear raw-domain filtering
+// commutes with an affine conversion, so it belongs in the frame filter.
+// Reads back through the same value(phase)/values() surface as polyphase.
+template<typename Raw, typename Filter, std::size_t N>
+  requires some_frame_filter<Filter, N>
+        && std::floating_point<typename Filter::value_type::value_type>
+        && (N > 0)
+class soa_polyphase {
+public:
+  using sample_type = std::array<Raw, N>;
+  using raw_type = Raw;
+  using value_type = typename Filter::value_type::value_type;
+  using values_type = std::array<value_type, N>;
+
+  static constexpr std::size_t phase_count = N;
+private:
+  values_type gains_;
+  values_type offsets_;
+  Filter filter_;
+public:
+  // Per-phase calibration.
+  soa_polyphase(values_type gains, values_type offsets, Filter filter)
+      : gains_(gains), offsets_(offsets), filter_(std::move(filter)) {}
+
+  // One calibration for every phase.
+  soa_polyphase(value_type gain, value_type offset, Filter filter)
+      : filter_(std::move(filter)) {
+    gains_.fill(gain);
+    offsets_.fill(offset);
+  }
+
+  value_type value(std::size_t phase) const {
+    return filter_.output()[phase];
+  }
+
+  values_type values() const {
+    return filter_.output();
+  }
+
+  Filter const& filter() const {
+    return filter_;
+  }
+
+  void set_calibration(std::size_t phase, value_type gain, value_type offset) {
+    gains_[phase] = gain;
+    offsets_[phase] = offset;
+  }
+
+  void submit(sample_type const& sample) {
+    values_type converted;
+    for (std::size_t p = 0; p < N; ++p) {
+      converted[p] =
+          gains_[p] * static_cast<value_type>(sample[p]) + offsets_[p];
+    }
+    filter_.push(converted);
+  }
+
+  void submit(std::span<sample_type const> samples) {
+    for (auto const& sample : samples) {
+      submit(sample);
+    }
+  }
+};
+
+} // namespace emb::sensor
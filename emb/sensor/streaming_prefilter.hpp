@@ -2,8 +2,10 @@
 
 #include <emb/sensor/concepts.hpp>
 
+#include <emb/filter/moving_average_filter.hpp>
 #include <emb/filter/passthrough_filter.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -15,7 +17,8 @@ namespace emb::sensor {
 // hierarchy:
 //   streaming_prefilter<passthrough_filter<T>>       -- no-op identity
 //   streaming_prefilter<moving_average_filter<T, K>> -- sliding raw average
-// Block (pack-in) reduction is a separate, native some_prefilter, not this.
+// Block (pack-in) reduction is a separate, native some_prefilter, not this:
+// see cic_prefilter.
 template<some_filter Filter>
 class streaming_prefilter {
 private:
@@ -39,4 +42,12 @@ public:
 template<typename T>
 using passthrough_prefilter = streaming_prefilter<passthrough_filter<T>>;
 
+// Sliding average of raw codes. Integer codes are summed exactly in a wider
+// integer accumulator (a shift replaces the division for power-of-two
+// windows), so conversion to the physical domain runs once per sample on the
+// already averaged code.
+template<typename T, std::size_t WindowSize>
+using moving_average_prefilter =
+    streaming_prefilter<moving_average_filter<T, WindowSize>>;
+
 } // namespace emb::sensor
@@ -0,0 +1,71 @@
+#include <emb/sensor/cic_prefilter.hpp>
+#include <emb/sensor/concepts.hpp>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+using emb::sensor::cic_prefilter;
+
+static_assert(emb::sensor::some_prefilter<cic_prefilter<std::uint16_t, 8>>);
+static_assert(std::same_as<
+              cic_prefilter<std::uint16_t, 16, 4>::register_type,
+              std::uint32_t>);
+static_assert(std::same_as<
+              cic_prefilter<std::uint16_t, 16, 5>::register_type,
+              std::uint64_t>);
+
+template<typename Prefilter>
+constexpr auto burst_of(typename Prefilter::value_type code) {
+  typename Prefilter::sample_type burst{};
+  burst.fill(code);
+  return burst;
+}
+
+// A constant input reaches the output exactly once the start-up transient
+// has passed, including full-scale codes that wrap the registers.
+template<typename Prefilter>
+constexpr bool test_cic_dc(Prefilter prefilter, auto code) {
+  constexpr std::size_t settle = Prefilter::order + Prefilter::tap_count;
+  for (std::size_t i = 0; i < settle + 3; ++i) {
+    auto const out = prefilter(burst_of<Prefilter>(code));
+    if (i >= settle) {
+      assert(out == code);
+    }
+  }
+  return true;
+}
+
+static_assert(test_cic_dc(cic_prefilter<std::uint16_t, 8>{}, 4095));
+static_assert(test_cic_dc(cic_prefilter<std::uint16_t, 16, 3>{}, 0xffff));
+static_assert(test_cic_dc(cic_prefilter<std::uint16_t, 10, 2>{}, 1234));
+static_assert(test_cic_dc(cic_prefilter<std::int16_t, 8, 3>{}, -2000));
+static_assert(test_cic_dc(cic_prefilter<std::int16_t, 5, 2>{}, -32768));
+static_assert(test_cic_dc(
+    cic_prefilter<std::uint16_t, 8, 2, 3>{
+        emb::sensor::cic_compensator_taps<2>()
+    },
+    3000
+));
+
+// A single-stage CIC is the block average.
+constexpr bool test_cic_first_order() {
+  cic_prefilter<std::uint16_t, 4, 1> prefilter;
+  assert(prefilter({1, 2, 3, 6}) == 3);
+  assert(prefilter({100, 100, 100, 104}) == 101);
+  prefilter.reset();
+  assert(prefilter({8, 8, 8, 8}) == 8);
+  return true;
+}
+
+static_assert(test_cic_first_order());
+
+static_assert(emb::sensor::cic_compensator_taps<2>()[0]
+                  + emb::sensor::cic_compensator_taps<2>()[1]
+                  + emb::sensor::cic_compensator_taps<2>()[2]
+              == (1 << 15));
+
+} // namespace
@@ -0,0 +1,121 @@
+#include <emb/sensor/concepts.hpp>
+#include <emb/sensor/transform.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <tuple>
+
+namespace {
+
+using emb::sensor::affine_stage;
+using emb::sensor::gain_stage;
+using emb::sensor::offset_stage;
+using emb::sensor::transform;
+
+constexpr bool near(float a, float b, float tolerance) {
+  return (a - b) <= tolerance && (b - a) <= tolerance;
+}
+
+// Current sense: shunt (V/A), amplifier gain, amplifier offset, divider
+// ratio, ADC scale (codes/V).
+constexpr auto current_sense = transform(
+    gain_stage(0.002f),
+    gain_stage(20.0f),
+    offset_stage(1.65f),
+    gain_stage(0.5f),
+    gain_stage(4096.0f / 3.3f)
+);
+
+static_assert(decltype(current_sense)::folded_stage_count == 1);
+static_assert(emb::sensor::some_converter<
+              decltype(current_sense),
+              std::uint16_t,
+              float>);
+
+// Reference: the same chain evaluated stage by stage.
+constexpr float unfolded_forward(float amps) {
+  return ((amps * 0.002f * 20.0f + 1.65f) * 0.5f) * (4096.0f / 3.3f);
+}
+
+constexpr float unfolded_inverse(float code) {
+  return ((code / (4096.0f / 3.3f) / 0.5f) - 1.65f) / 20.0f / 0.002f;
+}
+
+constexpr bool test_folded_chain() {
+  for (int i = -40; i <= 40; ++i) {
+    float const amps = static_cast<float>(i) * 0.5f;
+    assert(near(current_sense.forward(amps), unfolded_forward(amps), 1e-2f));
+  }
+  for (std::uint16_t code = 0; code < 4096; code += 97) {
+    float const c = static_cast<float>(code);
+    assert(near(current_sense(code), unfolded_inverse(c), 1e-3f));
+    assert(near(current_sense.forward(current_sense(code)), c, 1e-2f));
+  }
+  return true;
+}
+
+static_assert(test_folded_chain());
+
+// Non-linear stage: y = x^2 for x >= 0.
+struct square_stage {
+  constexpr float forward(float x) const {
+    return x * x;
+  }
+
+  constexpr float inverse(float y) const {
+    float x = y > 1.0f ? y / 2.0f : 1.0f;
+    for (int i = 0; i < 20; ++i) {
+      x = 0.5f * (x + y / x);
+    }
+    return x;
+  }
+};
+
+// The barrier splits the affine stages into two folded runs.
+constexpr auto with_barrier = transform(
+    gain_stage(2.0f),
+    offset_stage(1.0f),
+    square_stage{},
+    affine_stage<float>{.gain = 3.0f, .offset = -4.0f},
+    gain_stage(0.5f)
+);
+
+static_assert(decltype(with_barrier)::folded_stage_count == 3);
+
+constexpr bool test_barrier() {
+  for (int i = 0; i <= 10; ++i) {
+    float const x = static_cast<float>(i);
+    float const expected = ((2.0f * x + 1.0f) * (2.0f * x + 1.0f) * 3.0f - 4.0f)
+                         * 0.5f;
+    float const y = with_barrier.forward(x);
+    assert(near(y, expected, 1e-3f));
+    assert(near(with_barrier.inverse(y), x, 1e-3f));
+  }
+  return true;
+}
+
+static_assert(test_barrier());
+
+// Transforms stay assignable, and stages can be retuned after construction;
+// both refold.
+constexpr bool test_retune() {
+  auto t = transform(gain_stage(2.0f), offset_stage(1.0f));
+  assert(near(t.forward(3.0f), 7.0f, 1e-6f));
+
+  t.retune([](auto& s) { std::get<0>(s).gain = 4.0f; });
+  assert(std::get<0>(t.stages()).gain == 4.0f);
+  assert(near(t.forward(3.0f), 13.0f, 1e-6f));
+  assert(near(t.inverse(13.0f), 3.0f, 1e-6f));
+
+  t.set_stages(gain_stage(0.5f), offset_stage(-1.0f));
+  assert(near(t.forward(4.0f), 1.0f, 1e-6f));
+  assert(near(t.inverse(1.0f), 4.0f, 1e-6f));
+
+  t = transform(gain_stage(1.0f), offset_stage(0.0f));
+  assert(near(t(5.0f), 5.0f, 1e-6f));
+  return true;
+}
+
+static_assert(test_retune());
+
+} // namespace
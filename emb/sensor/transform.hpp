@@ -1,6 +1,9 @@
 #pragma once
 
+#include <concepts>
+#include <cstddef>
 #include <tuple>
+#include <utility>
 
 namespace emb::sensor {
 
@@ -13,8 +16,129 @@ namespace emb::sensor {
 // emb::sensor::some_converter and can be handed to a sensor
 // (singlephase/polyphase/buffered) directly.
 
+// Linear stage y = gain * x + offset: an amplifier, divider ratio, shunt
+// resistance, ADC scale or level shift. gain must be non-zero.
+template<std::floating_point T>
+struct affine_stage {
+  using value_type = T;
+
+  T gain = T(1);
+  T offset = T(0);
+
+  constexpr T forward(T x) const {
+    return gain * x + offset;
+  }
+
+  constexpr T inverse(T y) const {
+    return (y - offset) / gain;
+  }
+};
+
+template<std::floating_point T>
+constexpr affine_stage<T> gain_stage(T gain) {
+  return {.gain = gain, .offset = T(0)};
+}
+
+template<std::floating_point T>
+constexpr affine_stage<T> offset_stage(T offset) {
+  return {.gain = T(1), .offset = offset};
+}
+
+// Stages that transform folds: public gain and offset of one floating-point
+// type with affine_stage's meaning. Any other stage is a folding barrier.
+template<typename S>
+concept some_affine_stage = requires(S const& s) {
+  typename S::value_type;
+  requires std::floating_point<typename S::value_type>;
+  { s.gain } -> std::convertible_to<typename S::value_type>;
+  { s.offset } -> std::convertible_to<typename S::value_type>;
+};
+
 namespace detail {
 
+// A run of consecutive affine stages collapsed into one map per direction.
+// Both directions are a single multiply-add; the inverse uses the reciprocal
+// gain, so it agrees with chained divisions up to rounding.
+template<std::floating_point T>
+struct folded_affine_stage {
+  T forward_gain;
+  T forward_offset;
+  T inverse_gain;
+  T inverse_offset;
+
+  constexpr explicit folded_affine_stage(affine_stage<T> const& s)
+      : forward_gain(s.gain),
+        forward_offset(s.offset),
+        inverse_gain(T(1) / s.gain),
+        inverse_offset(-s.offset / s.gain) {}
+
+  constexpr T forward(auto x) const {
+    return forward_gain * static_cast<T>(x) + forward_offset;
+  }
+
+  constexpr T inverse(auto y) const {
+    return inverse_gain * static_cast<T>(y) + inverse_offset;
+  }
+};
+
+// outer(inner(x)) for two affine maps.
+template<std::floating_point T>
+constexpr affine_stage<T>
+compose_affine(affine_stage<T> const& inner, affine_stage<T> const& outer) {
+  return {
+      .gain = outer.gain * inner.gain,
+      .offset = outer.gain * inner.offset + outer.offset
+  };
+}
+
+template<typename S, typename T>
+concept affine_stage_of =
+    some_affine_stage<S> && std::same_as<typename S::value_type, T>;
+
+constexpr auto fold_stages() {
+  return std::tuple<>{};
+}
+
+template<typename Stage, typename... Rest>
+constexpr auto fold_stages(Stage const& s, Rest const&... rest);
+
+// Extends the current affine run while the next stage is affine of the same
+// type; otherwise closes the run and resumes at the barrier.
+template<typename T>
+constexpr auto fold_affine_run(affine_stage<T> const& run) {
+  return std::tuple<folded_affine_stage<T>>(folded_affine_stage<T>(run));
+}
+
+template<typename T, typename Stage, typename... Rest>
+constexpr auto fold_affine_run(
+    affine_stage<T> const& run,
+    Stage const& s,
+    Rest const&... rest
+) {
+  if constexpr (affine_stage_of<Stage, T>) {
+    affine_stage<T> const next{.gain = s.gain, .offset = s.offset};
+    return fold_affine_run(compose_affine(run, next), rest...);
+  } else {
+    return std::tuple_cat(
+        std::tuple<folded_affine_stage<T>>(folded_affine_stage<T>(run)),
+        fold_stages(s, rest...)
+    );
+  }
+}
+
+template<typename Stage, typename... Rest>
+constexpr auto fold_stages(Stage const& s, Rest const&... rest) {
+  if constexpr (some_affine_stage<Stage>) {
+    using T = typename Stage::value_type;
+    return fold_affine_run(
+        affine_stage<T>{.gain = s.gain, .offset = s.offset},
+        rest...
+    );
+  } else {
+    return std::tuple_cat(std::tuple<Stage>(s), fold_stages(rest...));
+  }
+}
+
 template<typename X>
 constexpr X transform_forward(X x) {
   return x;
@@ -37,19 +161,57 @@ constexpr auto transform_inverse(Y y, Stage const& s, Rest const&... rest) {
 
 } // namespace detail
 
+// Consecutive affine stages are folded into one gain/offset pair per
+// direction; non-affine stages stay in place as barriers. An all-affine chain
+// -- code scale, divider, shunt, amplifier, offset -- thus converts with one
+// multiply-add per sample. The fold is stored next to the stages and redone
+// whenever they change (set_stages, retune), so per-sample calls never pay for
+// it; for a constexpr transform it is done at compile time.
 template<typename... Stages>
 class transform {
+private:
+  using folded_type = decltype(detail::fold_stages(std::declval<Stages>()...));
+
+  std::tuple<Stages...> stages_;
+  folded_type folded_;
+
+  static constexpr folded_type fold(std::tuple<Stages...> const& stages) {
+    return std::apply(
+        [](auto const&... s) { return detail::fold_stages(s...); },
+        stages
+    );
+  }
 public:
-  std::tuple<Stages...> stages;
+  // Stages left after folding; 1 for an all-affine chain.
+  static constexpr std::size_t folded_stage_count =
+      std::tuple_size_v<folded_type>;
+
+  constexpr explicit transform(Stages... s)
+      : stages_{s...}, folded_(fold(stages_)) {}
+
+  constexpr std::tuple<Stages...> const& stages() const {
+    return stages_;
+  }
+
+  constexpr void set_stages(Stages... s) {
+    stages_ = {s...};
+    folded_ = fold(stages_);
+  }
 
-  constexpr explicit transform(Stages... s) : stages{s...} {}
+  // Calls f(stages) with the stage tuple writable, then refolds, e.g.
+  //   t.retune([&](auto& s) { std::get<0>(s).gain = calibrated_gain; });
+  template<std::invocable<std::tuple<Stages...>&> F>
+  constexpr void retune(F f) {
+    f(stages_);
+    folded_ = fold(stages_);
+  }
 
   // measured value -> sensor output (e.g. ADC code)
   // composes stages front to back
   constexpr auto forward(auto in) const {
     return std::apply(
         [&](auto const&... s) { return detail::transform_forward(in, s...); },
-        stages
+        folded_
     );
   }
 
@@ -58,7 +220,7 @@ public:
   constexpr auto inverse(auto out) const {
     return std::apply(
         [&](auto const&... s) { return detail::transform_inverse(out, s...); },
-        stages
+        folded_
     );
   }
 
@@ -1,6 +1,8 @@
 #include <emb/algorithm.hpp>
 
+#include <array>
 #include <cassert>
+#include <cstddef>
 
 namespace {
 
@@ -8,9 +10,55 @@ constexpr bool test_algorithm() {
   assert(emb::median3(1, 2, 3) == 2);
   assert(emb::median3(10, 2, 3) == 3);
   assert(emb::median3(-1.0f, 2.0f, 0.0f) == 0.0f);
+
+  assert(emb::median5(5, 1, 4, 2, 3) == 3);
+  assert(emb::median7(7, 1, 6, 2, 5, 3, 4) == 4);
+  assert(emb::median9(9, 1, 8, 2, 7, 3, 6, 4, 5) == 5);
+  assert(emb::median5(-1.0f, 2.0f, 0.0f, 0.0f, 8.0f) == 0.0f);
   return true;
 }
 
 static_assert(test_algorithm());
 
+// 0-1 principle: a compare-exchange network selects the median of every input
+// iff it does so for all 2^N inputs of zeros and ones.
+template<std::size_t N>
+constexpr bool test_median_network_exhaustive() {
+  for (unsigned bits = 0; bits < (1u << N); ++bits) {
+    std::array<int, N> v{};
+    std::size_t ones = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+      v[i] = static_cast<int>((bits >> i) & 1u);
+      ones += static_cast<std::size_t>(v[i]);
+    }
+    int const expected = ones > N / 2 ? 1 : 0;
+    assert(emb::median_network(v) == expected);
+  }
+  return true;
+}
+
+static_assert(test_median_network_exhaustive<1>());
+static_assert(test_median_network_exhaustive<3>());
+static_assert(test_median_network_exhaustive<5>());
+static_assert(test_median_network_exhaustive<7>());
+static_assert(test_median_network_exhaustive<9>());
+
+// Lane arrays: one network pass yields the median of each lane.
+constexpr bool test_median_lanes() {
+  using lanes = std::array<float, 3>;
+  lanes const m = emb::median5(
+      lanes{1.0f, 50.0f, -3.0f},
+      lanes{9.0f, 10.0f, -1.0f},
+      lanes{5.0f, 30.0f, -5.0f},
+      lanes{3.0f, 20.0f, -2.0f},
+      lanes{7.0f, 40.0f, -4.0f}
+  );
+  assert(m[0] == 5.0f);
+  assert(m[1] == 30.0f);
+  assert(m[2] == -3.0f);
+  return true;
+}
+
+static_assert(test_median_lanes());
+
 } // namespace
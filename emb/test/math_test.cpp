@@ -60,4 +60,116 @@ constexpr bool test_math() {
 
 static_assert(test_math());
 
+constexpr bool test_turns_sincos() {
+  [[maybe_unused]] constexpr auto near = [](float a, float b) {
+    return (a - b) < 1e-5f && (b - a) < 1e-5f;
+  };
+  [[maybe_unused]] constexpr float pi = std::numbers::pi_v<float>;
+
+  // turns wrap around the circle
+  emb::turns const quarter(0x4000'0000u);
+  assert(emb::turns::from_rad(pi / 2) == quarter);
+  assert(emb::turns::from_fraction(1.25f) == quarter);
+  assert(emb::turns::from_rad(-3 * pi / 2) == quarter);
+  assert(quarter + quarter + quarter + quarter == emb::turns{});
+  assert(-quarter == quarter + quarter + quarter);
+  assert(near(quarter.to_rad(), pi / 2));
+  assert(near((-quarter).to_rad(), 3 * pi / 2));
+  assert(near((-quarter).to_signed_rad(), -pi / 2));
+  assert(emb::turns(0xffff'ffffu).to_rad() < 2 * pi);
+
+  // sincos agrees with lookup_sin/lookup_cos in every quadrant
+  for (int i = -40; i <= 40; ++i) {
+    float const x = 0.37f * static_cast<float>(i);
+    auto const [s, c] = emb::sincos(x);
+    assert(near(s, emb::lookup_sin(x)));
+    assert(near(c, emb::lookup_cos(x)));
+    assert(near(s * s + c * c, 1.0f));
+  }
+  assert(emb::sincos(quarter).sin == 1.0f);
+  assert(emb::sincos(quarter).cos == 0.0f);
+  assert(emb::sincos(emb::turns{}).sin == 0.0f);
+
+  return true;
+}
+
+static_assert(test_turns_sincos());
+
+template<typename T, std::size_t Steps, emb::table_interp Interp>
+constexpr bool test_table_sincos(float tolerance) {
+  [[maybe_unused]] auto const near = [=](float a, float b) {
+    return (a - b) < tolerance && (b - a) < tolerance;
+  };
+
+  for (int i = -40; i <= 40; ++i) {
+    auto const angle = emb::turns::from_rad(0.37f * static_cast<float>(i));
+    auto const [s, c] = emb::table_sincos<T, Steps, Interp>(angle);
+    auto const [ref_s, ref_c] = emb::sincos(angle);
+    assert(near(s, ref_s));
+    assert(near(c, ref_c));
+  }
+  return true;
+}
+
+constexpr bool test_sin_table() {
+  // the generated 128-step table is the classic 129-entry one
+  static_assert(emb::sin_table<float, 128>.size() == 129);
+  static_assert(emb::sin_table<float, 128>[0] == 0.0f);
+  static_assert(emb::sin_table<float, 128>[1] == 0.012271538285719931f);
+  static_assert(emb::sin_table<float, 128>[64] == 0.70710678118654757f);
+  static_assert(emb::sin_table<float, 128>[128] == 1.0f);
+
+  // fixed-point tables saturate at 1.0
+  static_assert(emb::sin_table<std::int16_t, 64>[0] == 0);
+  static_assert(emb::sin_table<std::int16_t, 64>[32] == 23170);
+  static_assert(emb::sin_table<std::int16_t, 64>[64] == 32767);
+  static_assert(emb::sin_table<std::int32_t, 64>[64] == 2147483647);
+
+  using enum emb::table_interp;
+  assert((test_table_sincos<float, 64, nearest>(1.3e-2f)));
+  assert((test_table_sincos<float, 64, linear>(1e-4f)));
+  assert((test_table_sincos<float, 64, angle_sum>(1e-6f)));
+  assert((test_table_sincos<float, 4096, linear>(1e-6f)));
+  assert((test_table_sincos<std::int16_t, 256, angle_sum>(5e-5f)));
+  assert((test_table_sincos<std::int32_t, 1024, linear>(1e-6f)));
+
+  // quadrant boundaries hit the table ends exactly
+  emb::turns const quarter(0x4000'0000u);
+  assert((emb::table_sincos<float, 256, nearest>(quarter).sin == 1.0f));
+  assert((emb::table_sincos<float, 256, linear>(quarter).cos == 0.0f));
+
+  return true;
+}
+
+static_assert(test_sin_table());
+
+template<emb::some_math_tier Tier>
+constexpr bool test_math_tier(float tolerance) {
+  [[maybe_unused]] auto const near = [=](float a, float b) {
+    return (a - b) < tolerance && (b - a) < tolerance;
+  };
+  [[maybe_unused]] constexpr float pi = std::numbers::pi_v<float>;
+
+  assert(near(emb::sin<Tier>(pi / 6), 0.5f));
+  assert(near(emb::sin<Tier>(-5 * pi / 2), -1.0f));
+  assert(near(emb::cos<Tier>(pi / 3), 0.5f));
+  assert(near(emb::cos<Tier>(7 * pi), -1.0f));
+
+  assert(near(emb::atan2<Tier>(1.0f, 1.0f), pi / 4));
+  assert(near(emb::atan2<Tier>(-1.0f, -1.0f), -3 * pi / 4));
+  assert(near(emb::atan2<Tier>(0.5f, -0.0001f), pi / 2 + 0.0002f));
+  assert(near(emb::atan2<Tier>(0.0f, 0.0f), 0.0f));
+
+  assert(near(emb::sqrt<Tier>(2.0f), std::numbers::sqrt2_v<float>));
+  assert(near(emb::sqrt<Tier>(0.25f), 0.5f));
+  assert(near(emb::sqrt<Tier>(1e6f) / 1000.0f, 1.0f));
+  assert(near(emb::sqrt<Tier>(0.0f), 0.0f));
+
+  return true;
+}
+
+static_assert(test_math_tier<emb::lut_tier>(1e-6f));
+static_assert(test_math_tier<emb::poly_tier>(1e-5f));
+static_assert(test_math_tier<emb::builtin_tier>(1e-5f));
+
 } // namespace